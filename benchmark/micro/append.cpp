@@ -2,6 +2,8 @@
 #include "duckdb_benchmark_macro.hpp"
 #include "duckdb/main/appender.hpp"
 
+#include <thread>
+
 using namespace duckdb;
 
 //////////////
@@ -219,3 +221,48 @@ string BenchmarkInfo() override {
 	return "Write 100K 4-byte integers to CSV";
 }
 FINISH_BENCHMARK(Write100KIntegers)
+
+//////////////////
+// GROUP COMMIT //
+//////////////////
+#define APPEND_BENCHMARK_CONCURRENT_COMMITS(COMMIT_DELAY)                                                              \
+	void Load(DuckDBBenchmarkState *state) override {                                                                  \
+		state->conn.Query("CREATE TABLE integers(i INTEGER, j VARCHAR)");                                              \
+		state->conn.Query("SET commit_delay=" + std::to_string(COMMIT_DELAY));                                         \
+	}                                                                                                                  \
+	void RunBenchmark(DuckDBBenchmarkState *state) override {                                                          \
+		vector<std::thread> threads;                                                                                   \
+		for (int32_t t = 0; t < 8; t++) {                                                                              \
+			threads.emplace_back([state, t]() {                                                                        \
+				Connection conn(state->db);                                                                            \
+				for (int32_t i = 0; i < 1000; i++) {                                                                   \
+					auto value = std::to_string(t * 1000 + i);                                                         \
+					conn.Query("INSERT INTO integers VALUES (" + value + ", '" + value + "'), (" + value + ", NULL)"); \
+				}                                                                                                      \
+			});                                                                                                        \
+		}                                                                                                              \
+		for (auto &thread : threads) {                                                                                 \
+			thread.join();                                                                                             \
+		}                                                                                                              \
+	}                                                                                                                  \
+	void Cleanup(DuckDBBenchmarkState *state) override {                                                               \
+		state->conn.Query("DROP TABLE integers");                                                                      \
+		Load(state);                                                                                                   \
+	}                                                                                                                  \
+	string VerifyResult(QueryResult *result) override {                                                                \
+		return string();                                                                                               \
+	}                                                                                                                  \
+	bool InMemory() override {                                                                                         \
+		return false;                                                                                                  \
+	}                                                                                                                  \
+	string BenchmarkInfo() override {                                                                                  \
+		return "Append 16K rows from 8 concurrent connections, each committing 1000 INSERT INTO statements";           \
+	}
+
+DUCKDB_BENCHMARK(Append16KRowsConcurrentCommits, "[append]")
+APPEND_BENCHMARK_CONCURRENT_COMMITS(0)
+FINISH_BENCHMARK(Append16KRowsConcurrentCommits)
+
+DUCKDB_BENCHMARK(Append16KRowsConcurrentCommitsDelay, "[append]")
+APPEND_BENCHMARK_CONCURRENT_COMMITS(200)
+FINISH_BENCHMARK(Append16KRowsConcurrentCommitsDelay)
@@ -239,12 +239,19 @@ void ColumnReader::InitializeRead(idx_t row_group_idx_p, const vector<ColumnChun
 }
 
 void ColumnReader::PrepareRead(parquet_filter_t &filter) {
+	PageHeader page_hdr;
+	reader.Read(page_hdr, *protocol);
+	PrepareRead(page_hdr);
+}
+
+void ColumnReader::PrepareRead(PageHeader &page_hdr) {
 	dict_decoder.reset();
 	defined_decoder.reset();
 	bss_decoder.reset();
+	dbp_decoder.reset();
+	rle_decoder.reset();
+	byte_array_data.reset();
 	block.reset();
-	PageHeader page_hdr;
-	reader.Read(page_hdr, *protocol);
 
 	switch (page_hdr.type) {
 	case PageType::DATA_PAGE_V2:
@@ -582,9 +589,51 @@ void ColumnReader::Skip(idx_t num_values) {
 	pending_skips += num_values;
 }
 
+idx_t ColumnReader::SkipPages(idx_t num_values) {
+	if (num_values < page_rows_available) {
+		return num_values;
+	}
+	num_values -= page_rows_available;
+	group_rows_available -= page_rows_available;
+	page_rows_available = 0;
+
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+	while (num_values > 0) {
+		PageHeader page_hdr;
+		reader.Read(page_hdr, *protocol);
+		idx_t page_values = NumericLimits<idx_t>::Maximum();
+		if (page_hdr.type == PageType::DATA_PAGE && page_hdr.__isset.data_page_header) {
+			page_values = NumericCast<idx_t>(page_hdr.data_page_header.num_values);
+		} else if (page_hdr.type == PageType::DATA_PAGE_V2 && page_hdr.__isset.data_page_header_v2) {
+			page_values = NumericCast<idx_t>(page_hdr.data_page_header_v2.num_values);
+		}
+		if (page_values <= num_values) {
+			// skip over the entire data page
+			trans.SetLocation(trans.GetLocation() + NumericCast<idx_t>(page_hdr.compressed_page_size));
+			num_values -= page_values;
+			group_rows_available -= page_values;
+			continue;
+		}
+		// we need the contents of this page, e.g., it is a dictionary page or we only skip part of it
+		PrepareRead(page_hdr);
+		if (page_rows_available > 0) {
+			break;
+		}
+	}
+	return num_values;
+}
+
 void ColumnReader::ApplyPendingSkips(idx_t num_values) {
 	pending_skips -= num_values;
 
+	if (!reader.parquet_options.encryption_config) {
+		// encrypted pages are larger than their compressed size, so we can only skip them by reading them
+		num_values = SkipPages(num_values);
+		if (num_values == 0) {
+			return;
+		}
+	}
+
 	dummy_define.zero();
 	dummy_repeat.zero();
 
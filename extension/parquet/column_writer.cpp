@@ -1,6 +1,9 @@
 #include "column_writer.hpp"
 
 #include "duckdb.hpp"
+#include "parquet_bloom_filter.hpp"
+#include "parquet_bss_encoder.hpp"
+#include "parquet_dbp_encoder.hpp"
 #include "parquet_rle_bp_decoder.hpp"
 #include "parquet_rle_bp_encoder.hpp"
 #include "parquet_writer.hpp"
@@ -89,6 +92,9 @@ string ColumnWriterStatistics::GetMaxValue() {
 	return string();
 }
 
+void ColumnWriterStatistics::Merge(ColumnWriterStatistics &other) {
+}
+
 //===--------------------------------------------------------------------===//
 // RleBpEncoder
 //===--------------------------------------------------------------------===//
@@ -326,6 +332,8 @@ struct PageWriteInformation {
 	PageHeader page_header;
 	unique_ptr<MemoryStream> temp_writer;
 	unique_ptr<ColumnWriterPageState> page_state;
+	//! The statistics of this page (only gathered if we write the page index)
+	unique_ptr<ColumnWriterStatistics> page_stats;
 	idx_t write_page_idx = 0;
 	idx_t write_count = 0;
 	idx_t max_write_count = 0;
@@ -348,6 +356,14 @@ public:
 	vector<PageWriteInformation> write_info;
 	unique_ptr<ColumnWriterStatistics> stats_state;
 	idx_t current_page = 0;
+
+	//! Whether or not we write the page index for this column chunk
+	bool write_page_index = false;
+	//! The min/max values and null counts of the data pages, only valid if every non-null page has statistics
+	duckdb_parquet::format::ColumnIndex column_index;
+	bool column_index_valid = true;
+	//! The Bloom filter over the distinct values of this column chunk (if any)
+	unique_ptr<ParquetBloomFilter> bloom_filter;
 };
 
 //===--------------------------------------------------------------------===//
@@ -373,6 +389,10 @@ public:
 	//! we stop creating the dictionary
 	static constexpr const idx_t DICTIONARY_ANALYZE_THRESHOLD = 1e4;
 
+	//! The maximum number of rows in a page of a column without repeats. Smaller pages allow readers to skip more data
+	//! using the page index
+	static constexpr const idx_t MAX_PAGE_ROW_COUNT = 20000;
+
 	//! The maximum size a key entry in an RLE page takes
 	static constexpr const idx_t MAX_DICTIONARY_KEY_SIZE = sizeof(uint32_t);
 	//! The size of encoding the string length
@@ -393,12 +413,17 @@ protected:
 
 	void NextPage(BasicColumnWriterState &state);
 	void FlushPage(BasicColumnWriterState &state);
+	//! Adds the statistics of the flushed page to the column index
+	void AddPageToColumnIndex(BasicColumnWriterState &state, PageWriteInformation &write_info,
+	                          const PageInformation &page_info);
 
 	//! Initializes the state used to track statistics during writing. Only used for scalar types.
 	virtual unique_ptr<ColumnWriterStatistics> InitializeStatsState();
 
 	//! Initialize the writer for a specific page. Only used for scalar types.
-	virtual unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state);
+	virtual unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state, idx_t page_idx);
+	//! The number of values (i.e., non-null entries) that are written to a specific page
+	idx_t GetPageValueCount(BasicColumnWriterState &state, idx_t page_idx) const;
 
 	//! Flushes the writer for a specific page. Only used for scalar types.
 	virtual void FlushPageState(WriteStream &temp_writer, ColumnWriterPageState *state);
@@ -437,10 +462,23 @@ void BasicColumnWriter::RegisterToRowGroup(duckdb_parquet::format::RowGroup &row
 	row_group.columns.push_back(std::move(column_chunk));
 }
 
-unique_ptr<ColumnWriterPageState> BasicColumnWriter::InitializePageState(BasicColumnWriterState &state) {
+unique_ptr<ColumnWriterPageState> BasicColumnWriter::InitializePageState(BasicColumnWriterState &state,
+                                                                         idx_t page_idx) {
 	return nullptr;
 }
 
+idx_t BasicColumnWriter::GetPageValueCount(BasicColumnWriterState &state, idx_t page_idx) const {
+	auto &page_info = state.page_info[page_idx];
+	if (state.definition_levels.empty()) {
+		return page_info.row_count - page_info.empty_count;
+	}
+	idx_t value_count = 0;
+	for (idx_t i = page_info.offset; i < page_info.offset + page_info.row_count; i++) {
+		value_count += state.definition_levels[i] == max_define;
+	}
+	return value_count;
+}
+
 void BasicColumnWriter::FlushPageState(WriteStream &temp_writer, ColumnWriterPageState *state) {
 }
 
@@ -455,6 +493,8 @@ void BasicColumnWriter::Prepare(ColumnWriterState &state_p, ColumnWriterState *p
 	HandleRepeatLevels(state, parent, count, max_repeat);
 	HandleDefineLevels(state, parent, validity, count, max_define, max_define - 1);
 
+	// the row count of a page is only limited if a page index is written (see BeginWrite)
+	const auto write_page_index = max_repeat == 0 && writer.WriteIndexes();
 	idx_t vector_index = 0;
 	for (idx_t i = start; i < vcount; i++) {
 		auto &page_info = state.page_info.back();
@@ -466,11 +506,13 @@ void BasicColumnWriter::Prepare(ColumnWriterState &state_p, ColumnWriterState *p
 		}
 		if (validity.RowIsValid(vector_index)) {
 			page_info.estimated_page_size += GetRowSize(vector, vector_index, state);
-			if (page_info.estimated_page_size >= MAX_UNCOMPRESSED_PAGE_SIZE) {
-				PageInformation new_info;
-				new_info.offset = page_info.offset + page_info.row_count;
-				state.page_info.push_back(new_info);
-			}
+		}
+		// every value is a row if there are no repeats, so we can start a new page after any value
+		if (page_info.estimated_page_size >= MAX_UNCOMPRESSED_PAGE_SIZE ||
+		    (write_page_index && page_info.row_count >= MAX_PAGE_ROW_COUNT)) {
+			PageInformation new_info;
+			new_info.offset = page_info.offset + page_info.row_count;
+			state.page_info.push_back(new_info);
 		}
 		vector_index++;
 	}
@@ -485,6 +527,8 @@ void BasicColumnWriter::BeginWrite(ColumnWriterState &state_p) {
 
 	// set up the page write info
 	state.stats_state = InitializeStatsState();
+	// the page index requires pages to start at row boundaries, which only holds if there are no repeats
+	state.write_page_index = max_repeat == 0 && writer.WriteIndexes();
 	for (idx_t page_idx = 0; page_idx < state.page_info.size(); page_idx++) {
 		auto &page_info = state.page_info[page_idx];
 		if (page_info.row_count == 0) {
@@ -508,7 +552,10 @@ void BasicColumnWriter::BeginWrite(ColumnWriterState &state_p) {
 		write_info.temp_writer = make_uniq<MemoryStream>();
 		write_info.write_count = page_info.empty_count;
 		write_info.max_write_count = page_info.row_count;
-		write_info.page_state = InitializePageState(state);
+		write_info.page_state = InitializePageState(state, page_idx);
+		if (state.write_page_index) {
+			write_info.page_stats = InitializeStatsState();
+		}
 
 		write_info.compressed_size = 0;
 		write_info.compressed_data = nullptr;
@@ -598,6 +645,34 @@ void BasicColumnWriter::FlushPage(BasicColumnWriterState &state) {
 		D_ASSERT(write_info.compressed_buf.get() == write_info.compressed_data);
 		write_info.temp_writer.reset();
 	}
+
+	if (write_info.page_stats) {
+		AddPageToColumnIndex(state, write_info, state.page_info[state.current_page - 1]);
+		state.stats_state->Merge(*write_info.page_stats);
+		write_info.page_stats.reset();
+	}
+}
+
+void BasicColumnWriter::AddPageToColumnIndex(BasicColumnWriterState &state, PageWriteInformation &write_info,
+                                             const PageInformation &page_info) {
+	auto &column_index = state.column_index;
+	idx_t null_count = 0;
+	if (!state.definition_levels.empty()) {
+		for (idx_t i = page_info.offset; i < page_info.offset + page_info.row_count; i++) {
+			null_count += state.definition_levels[i] != max_define;
+		}
+	}
+	auto &page_stats = *write_info.page_stats;
+	const auto null_page = null_count == page_info.row_count;
+	if (!null_page && !page_stats.HasStats()) {
+		// we cannot write the min/max of this page, so we cannot write the column index
+		state.column_index_valid = false;
+	}
+	column_index.null_pages.push_back(null_page);
+	column_index.min_values.push_back(null_page ? string() : page_stats.GetMinValue());
+	column_index.max_values.push_back(null_page ? string() : page_stats.GetMaxValue());
+	column_index.null_counts.push_back(NumericCast<int64_t>(null_count));
+	column_index.__isset.null_counts = true;
 }
 
 unique_ptr<ColumnWriterStatistics> BasicColumnWriter::InitializeStatsState() {
@@ -622,8 +697,8 @@ void BasicColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, idx_t
 		idx_t write_count = MinValue<idx_t>(remaining, write_info.max_write_count - write_info.write_count);
 		D_ASSERT(write_count > 0);
 
-		WriteVector(temp_writer, state.stats_state.get(), write_info.page_state.get(), vector, offset,
-		            offset + write_count);
+		auto stats = write_info.page_stats ? write_info.page_stats.get() : state.stats_state.get();
+		WriteVector(temp_writer, stats, write_info.page_state.get(), vector, offset, offset + write_count);
 
 		write_info.write_count += write_count;
 		if (write_info.write_count == write_info.max_write_count) {
@@ -669,8 +744,12 @@ void BasicColumnWriter::SetParquetStatistics(BasicColumnWriterState &state,
 		column_chunk.meta_data.statistics.__isset.distinct_count = true;
 		column_chunk.meta_data.__isset.statistics = true;
 	}
+	auto &encodings = column_chunk.meta_data.encodings;
 	for (const auto &write_info : state.write_info) {
-		column_chunk.meta_data.encodings.push_back(write_info.page_header.data_page_header.encoding);
+		auto encoding = write_info.page_header.data_page_header.encoding;
+		if (std::find(encodings.begin(), encodings.end(), encoding) == encodings.end()) {
+			encodings.push_back(encoding);
+		}
 	}
 }
 
@@ -698,6 +777,8 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 
 	// write the individual pages to disk
 	idx_t total_uncompressed_size = 0;
+	duckdb_parquet::format::OffsetIndex offset_index;
+	idx_t data_page_idx = 0;
 	for (auto &write_info : state.write_info) {
 		// set the data page offset whenever we see the *first* data page
 		if (column_chunk.meta_data.data_page_offset == 0 && (write_info.page_header.type == PageType::DATA_PAGE ||
@@ -712,9 +793,35 @@ void BasicColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 		total_uncompressed_size += column_writer.GetTotalWritten() - header_start_offset;
 		total_uncompressed_size += write_info.page_header.uncompressed_page_size;
 		writer.WriteData(write_info.compressed_data, write_info.compressed_size);
+		if (state.write_page_index && write_info.page_header.type == PageType::DATA_PAGE) {
+			duckdb_parquet::format::PageLocation page_location;
+			page_location.offset = NumericCast<int64_t>(header_start_offset);
+			page_location.compressed_page_size =
+			    NumericCast<int32_t>(column_writer.GetTotalWritten() - header_start_offset);
+			page_location.first_row_index = NumericCast<int64_t>(state.page_info[data_page_idx++].offset);
+			offset_index.page_locations.push_back(page_location);
+		}
 	}
 	column_chunk.meta_data.total_compressed_size = column_writer.GetTotalWritten() - start_offset;
 	column_chunk.meta_data.total_uncompressed_size = total_uncompressed_size;
+
+	if (state.bloom_filter) {
+		// the Bloom filter is written directly after the column chunk
+		auto bloom_filter_offset = column_writer.GetTotalWritten();
+		state.bloom_filter->Write(*writer.GetProtocol());
+		column_chunk.meta_data.__set_bloom_filter_offset(NumericCast<int64_t>(bloom_filter_offset));
+		column_chunk.meta_data.__set_bloom_filter_length(
+		    NumericCast<int32_t>(column_writer.GetTotalWritten() - bloom_filter_offset));
+	}
+	if (state.write_page_index) {
+		// the page index is written together with the page indexes of all other column chunks before the footer
+		unique_ptr<duckdb_parquet::format::ColumnIndex> column_index;
+		if (state.column_index_valid) {
+			state.column_index.boundary_order = duckdb_parquet::format::BoundaryOrder::UNORDERED;
+			column_index = make_uniq<duckdb_parquet::format::ColumnIndex>(std::move(state.column_index));
+		}
+		writer.AddPageIndex(state.col_idx, std::move(column_index), std::move(offset_index));
+	}
 }
 
 void BasicColumnWriter::FlushDictionary(BasicColumnWriterState &state, ColumnWriterStatistics *stats) {
@@ -784,6 +891,16 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? string((char *)&max, sizeof(T)) : string();
 	}
+
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<NumericStatisticsState<SRC, T, OP>>();
+		if (LessThan::Operation(other.min, min)) {
+			min = other.min;
+		}
+		if (GreaterThan::Operation(other.max, max)) {
+			max = other.max;
+		}
+	}
 };
 
 struct BaseParquetOperator {
@@ -877,6 +994,132 @@ static void TemplatedWritePlain(Vector &col, ColumnWriterStatistics *stats, idx_
 	}
 }
 
+//! Chooses the encoding of the data pages of a column chunk of a standard column writer
+//! Integers can use DELTA_BINARY_PACKED, which we use if the deltas between the values are smaller than the values
+template <class T, bool IS_INTEGRAL = std::is_integral<T>::value>
+class StandardEncodingAnalyzer {
+public:
+	static bool HasAnalyze(ParquetWriter &writer) {
+		return writer.GetParquetVersion() != ParquetVersion::V1;
+	}
+
+	void Analyze(T value) {
+		if (value_count == 0) {
+			dbp_encoder.BeginPrepare(value);
+		} else {
+			dbp_encoder.PrepareValue(value);
+		}
+		value_count++;
+	}
+
+	Encoding::type GetEncoding(ParquetWriter &writer) {
+		if (!HasAnalyze(writer) || value_count == 0) {
+			return Encoding::PLAIN;
+		}
+		dbp_encoder.FinishPrepare();
+		return dbp_encoder.GetByteCount() < value_count * sizeof(T) ? Encoding::DELTA_BINARY_PACKED : Encoding::PLAIN;
+	}
+
+private:
+	idx_t value_count = 0;
+	DbpEncoder<T> dbp_encoder;
+};
+
+//! Floating point values can use BYTE_STREAM_SPLIT. This does not make the data smaller, but it groups the bytes of
+//! the sign/exponent and the mantissa of the values, which makes the data (much) more compressible
+template <class T>
+class StandardEncodingAnalyzer<T, false> {
+public:
+	static bool HasAnalyze(ParquetWriter &writer) {
+		return false;
+	}
+
+	void Analyze(T value) {
+	}
+
+	Encoding::type GetEncoding(ParquetWriter &writer) {
+		if (writer.GetParquetVersion() == ParquetVersion::V1 || writer.GetCodec() == CompressionCodec::UNCOMPRESSED) {
+			return Encoding::PLAIN;
+		}
+		return Encoding::BYTE_STREAM_SPLIT;
+	}
+};
+
+template <class T>
+class StandardColumnWriterState : public BasicColumnWriterState {
+public:
+	StandardColumnWriterState(duckdb_parquet::format::RowGroup &row_group, idx_t col_idx)
+	    : BasicColumnWriterState(row_group, col_idx) {
+	}
+	~StandardColumnWriterState() override = default;
+
+	StandardEncodingAnalyzer<T> analyzer;
+	//! The encoding of the data pages
+	Encoding::type encoding = Encoding::PLAIN;
+};
+
+template <class T, bool IS_INTEGRAL = std::is_integral<T>::value>
+class StandardWriterPageState : public ColumnWriterPageState {
+public:
+	StandardWriterPageState(Encoding::type encoding, idx_t value_count)
+	    : encoding(encoding), dbp_encoder(value_count), dbp_initialized(false) {
+	}
+
+	//! Writes a value that is not PLAIN encoded
+	void WriteValue(WriteStream &temp_writer, T value) {
+		D_ASSERT(encoding == Encoding::DELTA_BINARY_PACKED);
+		if (!dbp_initialized) {
+			dbp_encoder.BeginWrite(temp_writer, value);
+			dbp_initialized = true;
+		} else {
+			dbp_encoder.WriteValue(temp_writer, value);
+		}
+	}
+
+	void Flush(WriteStream &temp_writer) {
+		if (encoding == Encoding::PLAIN) {
+			return;
+		}
+		if (!dbp_initialized) {
+			// all values are null, we still write the header
+			dbp_encoder.BeginWrite(temp_writer, 0);
+		}
+		dbp_encoder.FinishWrite(temp_writer);
+	}
+
+	const Encoding::type encoding;
+
+private:
+	DbpEncoder<T> dbp_encoder;
+	bool dbp_initialized;
+};
+
+template <class T>
+class StandardWriterPageState<T, false> : public ColumnWriterPageState {
+public:
+	StandardWriterPageState(Encoding::type encoding, idx_t value_count)
+	    : encoding(encoding), bss_encoder(encoding == Encoding::PLAIN ? 0 : value_count, sizeof(T)) {
+	}
+
+	//! Writes a value that is not PLAIN encoded
+	void WriteValue(WriteStream &temp_writer, T value) {
+		D_ASSERT(encoding == Encoding::BYTE_STREAM_SPLIT);
+		bss_encoder.WriteValue<T>(value);
+	}
+
+	void Flush(WriteStream &temp_writer) {
+		if (encoding == Encoding::PLAIN) {
+			return;
+		}
+		bss_encoder.FinishWrite(temp_writer);
+	}
+
+	const Encoding::type encoding;
+
+private:
+	BssEncoder bss_encoder;
+};
+
 template <class SRC, class TGT, class OP = ParquetCastOperator>
 class StandardColumnWriter : public BasicColumnWriter {
 public:
@@ -891,10 +1134,76 @@ public:
 		return OP::template InitializeStats<SRC, TGT>();
 	}
 
-	void WriteVector(WriteStream &temp_writer, ColumnWriterStatistics *stats, ColumnWriterPageState *page_state,
+	unique_ptr<ColumnWriterState> InitializeWriteState(duckdb_parquet::format::RowGroup &row_group) override {
+		auto result = make_uniq<StandardColumnWriterState<TGT>>(row_group, row_group.columns.size());
+		result->encoding = result->analyzer.GetEncoding(writer);
+		RegisterToRowGroup(row_group);
+		return std::move(result);
+	}
+
+	bool HasAnalyze() override {
+		return StandardEncodingAnalyzer<TGT>::HasAnalyze(writer);
+	}
+
+	void Analyze(ColumnWriterState &state_p, ColumnWriterState *parent, Vector &vector, idx_t count) override {
+		auto &state = state_p.Cast<StandardColumnWriterState<TGT>>();
+
+		// the levels of a parent are only written in Prepare, which runs after the analysis: until then, every entry of
+		// the vector is a value
+		idx_t vcount = parent && !parent->definition_levels.empty()
+		                   ? parent->definition_levels.size() - state.definition_levels.size()
+		                   : count;
+		idx_t parent_index = state.definition_levels.size();
+		auto &validity = FlatVector::Validity(vector);
+		auto *ptr = FlatVector::GetData<SRC>(vector);
+		idx_t vector_index = 0;
+		for (idx_t i = 0; i < vcount; i++) {
+			if (parent && !parent->is_empty.empty() && parent->is_empty[parent_index + i]) {
+				continue;
+			}
+			if (validity.RowIsValid(vector_index)) {
+				state.analyzer.Analyze(OP::template Operation<SRC, TGT>(ptr[vector_index]));
+			}
+			vector_index++;
+		}
+	}
+
+	void FinalizeAnalyze(ColumnWriterState &state_p) override {
+		auto &state = state_p.Cast<StandardColumnWriterState<TGT>>();
+		state.encoding = state.analyzer.GetEncoding(writer);
+	}
+
+	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state_p, idx_t page_idx) override {
+		auto &state = state_p.Cast<StandardColumnWriterState<TGT>>();
+		return make_uniq<StandardWriterPageState<TGT>>(state.encoding, GetPageValueCount(state, page_idx));
+	}
+
+	void FlushPageState(WriteStream &temp_writer, ColumnWriterPageState *state_p) override {
+		auto &page_state = state_p->Cast<StandardWriterPageState<TGT>>();
+		page_state.Flush(temp_writer);
+	}
+
+	duckdb_parquet::format::Encoding::type GetEncoding(BasicColumnWriterState &state_p) override {
+		auto &state = state_p.Cast<StandardColumnWriterState<TGT>>();
+		return state.encoding;
+	}
+
+	void WriteVector(WriteStream &temp_writer, ColumnWriterStatistics *stats, ColumnWriterPageState *page_state_p,
 	                 Vector &input_column, idx_t chunk_start, idx_t chunk_end) override {
+		auto &page_state = page_state_p->Cast<StandardWriterPageState<TGT>>();
 		auto &mask = FlatVector::Validity(input_column);
-		TemplatedWritePlain<SRC, TGT, OP>(input_column, stats, chunk_start, chunk_end, mask, temp_writer);
+		if (page_state.encoding == Encoding::PLAIN) {
+			TemplatedWritePlain<SRC, TGT, OP>(input_column, stats, chunk_start, chunk_end, mask, temp_writer);
+			return;
+		}
+		auto *ptr = FlatVector::GetData<SRC>(input_column);
+		for (idx_t r = chunk_start; r < chunk_end; r++) {
+			if (mask.RowIsValid(r)) {
+				TGT target_value = OP::template Operation<SRC, TGT>(ptr[r]);
+				OP::template HandleStats<SRC, TGT>(stats, ptr[r], target_value);
+				page_state.WriteValue(temp_writer, target_value);
+			}
+		}
 	}
 
 	idx_t GetRowSize(Vector &vector, idx_t index, BasicColumnWriterState &state) override {
@@ -930,6 +1239,12 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? string(const_char_ptr_cast(&max), sizeof(bool)) : string();
 	}
+
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<BooleanStatisticsState>();
+		min = min && other.min;
+		max = max || other.max;
+	}
 };
 
 class BooleanWriterPageState : public ColumnWriterPageState {
@@ -978,7 +1293,7 @@ public:
 		}
 	}
 
-	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state) override {
+	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state, idx_t page_idx) override {
 		return make_uniq<BooleanWriterPageState>();
 	}
 
@@ -1061,6 +1376,14 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? GetStats(max) : string();
 	}
+
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<FixedDecimalStatistics>();
+		if (other.HasStats()) {
+			Update(other.min);
+			Update(other.max);
+		}
+	}
 };
 
 class FixedDecimalColumnWriter : public BasicColumnWriter {
@@ -1243,6 +1566,19 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? max : string();
 	}
+
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<StringStatisticsState>();
+		if (other.values_too_big) {
+			values_too_big = true;
+			has_stats = false;
+			min = string();
+			max = string();
+		} else if (other.has_stats) {
+			Update(string_t(other.min));
+			Update(string_t(other.max));
+		}
+	}
 };
 
 class StringColumnWriterState : public BasicColumnWriterState {
@@ -1256,11 +1592,16 @@ public:
 	idx_t estimated_dict_page_size = 0;
 	idx_t estimated_rle_pages_size = 0;
 	idx_t estimated_plain_size = 0;
+	// the number of bytes consecutive values share, and the number of values this was computed for
+	idx_t estimated_prefix_size = 0;
+	idx_t prefix_value_count = 0;
 
 	// Dictionary and accompanying string heap
 	string_map_t<uint32_t> dictionary;
-	// key_bit_width== 0 signifies the chunk is written in plain encoding
+	// key_bit_width== 0 signifies the chunk is written without a dictionary
 	uint32_t key_bit_width;
+	// the encoding of the data pages
+	Encoding::type encoding = Encoding::PLAIN;
 
 	bool IsDictionaryEncoded() {
 		return key_bit_width != 0;
@@ -1269,19 +1610,30 @@ public:
 
 class StringWriterPageState : public ColumnWriterPageState {
 public:
-	explicit StringWriterPageState(uint32_t bit_width, const string_map_t<uint32_t> &values)
-	    : bit_width(bit_width), dictionary(values), encoder(bit_width), written_value(false) {
+	explicit StringWriterPageState(uint32_t bit_width, const string_map_t<uint32_t> &values, Encoding::type encoding,
+	                               bool write_page_stats)
+	    : bit_width(bit_width), dictionary(values), encoder(bit_width), written_value(false), encoding(encoding),
+	      write_page_stats(write_page_stats) {
 		D_ASSERT(IsDictionaryEncoded() || (bit_width == 0 && dictionary.empty()));
 	}
 
 	bool IsDictionaryEncoded() {
 		return bit_width != 0;
 	}
-	// if 0, we're writing a plain page
+	// if 0, we're writing a page without a dictionary
 	uint32_t bit_width;
 	const string_map_t<uint32_t> &dictionary;
 	RleBpEncoder encoder;
 	bool written_value;
+
+	Encoding::type encoding;
+	//! Whether the statistics of the page are written to the page index
+	bool write_page_stats;
+	// DELTA_LENGTH_BYTE_ARRAY and DELTA_BYTE_ARRAY pages write the lengths before the data, so we buffer the data
+	vector<uint32_t> prefix_lengths;
+	vector<uint32_t> suffix_lengths;
+	MemoryStream suffix_data;
+	string previous_value;
 };
 
 class StringColumnWriter : public BasicColumnWriter {
@@ -1309,6 +1661,10 @@ public:
 
 	void Analyze(ColumnWriterState &state_p, ColumnWriterState *parent, Vector &vector, idx_t count) override {
 		auto &state = state_p.Cast<StringColumnWriterState>();
+		if (writer.GetParquetVersion() != ParquetVersion::V1) {
+			// if we don't use a dictionary, this decides between DELTA_LENGTH_BYTE_ARRAY and DELTA_BYTE_ARRAY
+			AnalyzePrefixes(state, parent, vector, count);
+		}
 		if (writer.DictionaryCompressionRatioThreshold() == NumericLimits<double>::Maximum() ||
 		    (state.dictionary.size() > DICTIONARY_ANALYZE_THRESHOLD && WontUseDictionary(state))) {
 			// Early out: compression ratio is less than the specified parameter
@@ -1364,11 +1720,30 @@ public:
 		// check if a dictionary will require more space than a plain write, or if the dictionary page is going to
 		// be too large
 		if (WontUseDictionary(state)) {
-			// clearing the dictionary signals a plain write
+			// clearing the dictionary signals a write without a dictionary
 			state.dictionary.clear();
 			state.key_bit_width = 0;
+			if (writer.GetParquetVersion() == ParquetVersion::V1) {
+				state.encoding = Encoding::PLAIN;
+			} else if (state.estimated_prefix_size > state.prefix_value_count) {
+				// consecutive values share more than a byte on average, which is more than what it costs to write the
+				// prefix lengths
+				state.encoding = Encoding::DELTA_BYTE_ARRAY;
+			} else {
+				state.encoding = Encoding::DELTA_LENGTH_BYTE_ARRAY;
+			}
 		} else {
 			state.key_bit_width = RleBpDecoder::ComputeBitWidth(state.dictionary.size());
+			// the dictionary is empty if all values are NULL, then there is nothing to encode
+			state.encoding = state.IsDictionaryEncoded() ? Encoding::RLE_DICTIONARY : Encoding::PLAIN;
+			if (writer.WriteIndexes()) {
+				// the dictionary contains all distinct values, so we know exactly how large the Bloom filter has to be
+				state.bloom_filter = make_uniq<ParquetBloomFilter>(state.dictionary.size());
+				for (const auto &entry : state.dictionary) {
+					state.bloom_filter->Insert(
+					    ParquetBloomFilter::Hash(const_data_ptr_cast(entry.first.GetData()), entry.first.GetSize()));
+				}
+			}
 		}
 	}
 
@@ -1386,6 +1761,11 @@ public:
 					continue;
 				}
 				auto value_index = page_state.dictionary.at(ptr[r]);
+				// the statistics of the column chunk are computed from the dictionary, but the page index needs
+				// the statistics of the individual pages
+				if (page_state.write_page_stats) {
+					stats.Update(ptr[r]);
+				}
 				if (!page_state.written_value) {
 					// first value
 					// write the bit-width as a one-byte entry
@@ -1397,7 +1777,7 @@ public:
 					page_state.encoder.WriteValue(temp_writer, value_index);
 				}
 			}
-		} else {
+		} else if (page_state.encoding == Encoding::PLAIN) {
 			// plain page
 			for (idx_t r = chunk_start; r < chunk_end; r++) {
 				if (!mask.RowIsValid(r)) {
@@ -1407,12 +1787,34 @@ public:
 				temp_writer.Write<uint32_t>(ptr[r].GetSize());
 				temp_writer.WriteData(const_data_ptr_cast(ptr[r].GetData()), ptr[r].GetSize());
 			}
+		} else {
+			// DELTA_LENGTH_BYTE_ARRAY or DELTA_BYTE_ARRAY page
+			const auto write_prefixes = page_state.encoding == Encoding::DELTA_BYTE_ARRAY;
+			for (idx_t r = chunk_start; r < chunk_end; r++) {
+				if (!mask.RowIsValid(r)) {
+					continue;
+				}
+				stats.Update(ptr[r]);
+				auto data = const_data_ptr_cast(ptr[r].GetData());
+				auto size = ptr[r].GetSize();
+				idx_t prefix_length = 0;
+				if (write_prefixes) {
+					auto &previous_value = page_state.previous_value;
+					prefix_length = CommonPrefixLength(const_data_ptr_cast(previous_value.c_str()),
+					                                   previous_value.size(), data, size);
+					previous_value.assign(ptr[r].GetData(), size);
+					page_state.prefix_lengths.push_back(NumericCast<uint32_t>(prefix_length));
+				}
+				page_state.suffix_lengths.push_back(NumericCast<uint32_t>(size - prefix_length));
+				page_state.suffix_data.WriteData(data + prefix_length, size - prefix_length);
+			}
 		}
 	}
 
-	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state_p) override {
+	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state_p, idx_t page_idx) override {
 		auto &state = state_p.Cast<StringColumnWriterState>();
-		return make_uniq<StringWriterPageState>(state.key_bit_width, state.dictionary);
+		return make_uniq<StringWriterPageState>(state.key_bit_width, state.dictionary, state.encoding,
+		                                        state.write_page_index);
 	}
 
 	void FlushPageState(WriteStream &temp_writer, ColumnWriterPageState *state_p) override {
@@ -1425,12 +1827,19 @@ public:
 				return;
 			}
 			page_state.encoder.FinishWrite(temp_writer);
+		} else if (page_state.encoding != Encoding::PLAIN) {
+			// DELTA_BYTE_ARRAY writes the prefix lengths, followed by the suffixes in DELTA_LENGTH_BYTE_ARRAY
+			if (page_state.encoding == Encoding::DELTA_BYTE_ARRAY) {
+				WriteLengths(temp_writer, page_state.prefix_lengths);
+			}
+			WriteLengths(temp_writer, page_state.suffix_lengths);
+			temp_writer.WriteData(page_state.suffix_data.GetData(), page_state.suffix_data.GetPosition());
 		}
 	}
 
 	duckdb_parquet::format::Encoding::type GetEncoding(BasicColumnWriterState &state_p) override {
 		auto &state = state_p.Cast<StringColumnWriterState>();
-		return state.IsDictionaryEncoded() ? Encoding::RLE_DICTIONARY : Encoding::PLAIN;
+		return state.encoding;
 	}
 
 	bool HasDictionary(BasicColumnWriterState &state_p) override {
@@ -1481,6 +1890,51 @@ public:
 	}
 
 private:
+	void AnalyzePrefixes(StringColumnWriterState &state, ColumnWriterState *parent, Vector &vector, idx_t count) {
+		idx_t vcount = parent ? parent->definition_levels.size() - state.definition_levels.size() : count;
+		idx_t parent_index = state.definition_levels.size();
+		auto &validity = FlatVector::Validity(vector);
+		auto strings = FlatVector::GetData<string_t>(vector);
+		// we only compare the values within a vector, this is good enough as an estimate
+		optional_ptr<const string_t> previous_value;
+		idx_t vector_index = 0;
+		for (idx_t i = 0; i < vcount; i++) {
+			if (parent && !parent->is_empty.empty() && parent->is_empty[parent_index + i]) {
+				continue;
+			}
+			if (validity.RowIsValid(vector_index)) {
+				const auto &value = strings[vector_index];
+				if (previous_value) {
+					state.estimated_prefix_size +=
+					    CommonPrefixLength(const_data_ptr_cast(previous_value->GetData()), previous_value->GetSize(),
+					                       const_data_ptr_cast(value.GetData()), value.GetSize());
+				}
+				state.prefix_value_count++;
+				previous_value = &value;
+			}
+			vector_index++;
+		}
+	}
+
+	static idx_t CommonPrefixLength(const_data_ptr_t left, idx_t left_size, const_data_ptr_t right, idx_t right_size) {
+		const auto max_length = MinValue(left_size, right_size);
+		idx_t length = 0;
+		while (length < max_length && left[length] == right[length]) {
+			length++;
+		}
+		return length;
+	}
+
+	//! Writes the lengths of DELTA_LENGTH_BYTE_ARRAY and DELTA_BYTE_ARRAY pages
+	static void WriteLengths(WriteStream &temp_writer, const vector<uint32_t> &lengths) {
+		DbpEncoder<uint32_t> encoder(lengths.size());
+		encoder.BeginWrite(temp_writer, lengths.empty() ? 0 : lengths[0]);
+		for (idx_t i = 1; i < lengths.size(); i++) {
+			encoder.WriteValue(temp_writer, lengths[i]);
+		}
+		encoder.FinishWrite(temp_writer);
+	}
+
 	bool WontUseDictionary(StringColumnWriterState &state) const {
 		return state.estimated_dict_page_size > MAX_UNCOMPRESSED_DICT_PAGE_SIZE ||
 		       DictionaryCompressionRatio(state) < writer.DictionaryCompressionRatioThreshold();
@@ -1567,7 +2021,7 @@ public:
 		}
 	}
 
-	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state) override {
+	unique_ptr<ColumnWriterPageState> InitializePageState(BasicColumnWriterState &state, idx_t page_idx) override {
 		return make_uniq<EnumWriterPageState>(bit_width);
 	}
 
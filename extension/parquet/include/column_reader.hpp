@@ -109,6 +109,9 @@ protected:
 
 	// applies any skips that were registered using Skip()
 	virtual void ApplyPendingSkips(idx_t num_values);
+	// skips the remainder of the current page and any following data pages that are skipped entirely, without
+	// decompressing them. Returns the number of values that still have to be skipped
+	idx_t SkipPages(idx_t num_values);
 
 	bool HasDefines() {
 		return max_define > 0;
@@ -138,6 +141,7 @@ private:
 	void AllocateBlock(idx_t size);
 	void AllocateCompressed(idx_t size);
 	void PrepareRead(parquet_filter_t &filter);
+	void PrepareRead(PageHeader &page_hdr);
 	void PreparePage(PageHeader &page_hdr);
 	void PrepareDataPage(PageHeader &page_hdr);
 	void PreparePageV2(PageHeader &page_hdr);
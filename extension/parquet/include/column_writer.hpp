@@ -49,6 +49,8 @@ public:
 	virtual string GetMax();
 	virtual string GetMinValue();
 	virtual string GetMaxValue();
+	//! Merges the statistics gathered by another state (of the same type) into this one
+	virtual void Merge(ColumnWriterStatistics &other);
 
 public:
 	template <class TARGET>
@@ -0,0 +1,81 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#include "parquet_types.h"
+
+namespace duckdb {
+
+using duckdb_apache::thrift::protocol::TProtocol;
+
+//! The header that precedes the bitset of a Bloom filter in a Parquet file
+//! The format only defines one algorithm (split-block), one hash (XXH64) and no compression, which the unions in the
+//! header select. We only read Bloom filters that use these
+class ParquetBloomFilterHeader : public duckdb_apache::thrift::TBase {
+public:
+	int32_t num_bytes = 0;
+	bool block_algorithm = false;
+	bool xxhash = false;
+	bool uncompressed = false;
+
+public:
+	bool IsSupported() const;
+
+	uint32_t read(TProtocol *iprot) override;
+	uint32_t write(TProtocol *oprot) const override;
+};
+
+//! The split-block Bloom filter (SBBF) of the Parquet format. The bitset is divided into blocks of 256 bits, and every
+//! value sets one bit in each of the eight 32-bit words of the block that its hash selects
+class ParquetBloomFilter {
+public:
+	static constexpr const idx_t BYTES_PER_BLOCK = 32;
+	//! The number of bits per distinct value (about a 1% false positive rate)
+	static constexpr const idx_t BITS_PER_VALUE = 10;
+	//! The maximum size of a Bloom filter we write or read
+	static constexpr const idx_t MAX_BYTES = 128 * 1024 * 1024;
+
+	//! Creates an empty Bloom filter sized for the given number of distinct values
+	explicit ParquetBloomFilter(idx_t num_distinct_values);
+	//! Creates a Bloom filter over an existing bitset
+	ParquetBloomFilter(unsafe_unique_array<data_t> data, idx_t num_bytes);
+
+public:
+	void Insert(uint64_t hash);
+	bool Contains(uint64_t hash) const;
+
+	const_data_ptr_t Data() const {
+		return data.get();
+	}
+	idx_t Size() const {
+		return num_bytes;
+	}
+
+	//! Hashes the plain encoding of a value (for BYTE_ARRAY values: without the length prefix)
+	static uint64_t Hash(const_data_ptr_t value, idx_t size);
+	template <class T>
+	static uint64_t Hash(T value) {
+		return Hash(const_data_ptr_cast(&value), sizeof(T));
+	}
+
+	//! Writes the header and the bitset of this Bloom filter
+	void Write(TProtocol &oprot) const;
+	//! Reads a Bloom filter at the current location. Returns nullptr if the Bloom filter is not supported
+	static unique_ptr<ParquetBloomFilter> Read(TProtocol &iprot, optional_idx length);
+
+private:
+	uint32_t *GetBlock(uint64_t hash) const;
+
+private:
+	unsafe_unique_array<data_t> data;
+	idx_t num_bytes;
+};
+
+} // namespace duckdb
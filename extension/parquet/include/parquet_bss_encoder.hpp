@@ -0,0 +1,51 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_bss_encoder.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/serializer/write_stream.hpp"
+#endif
+
+namespace duckdb {
+
+//! Encoder for the Byte Stream Split encoding, the counterpart of the BssDecoder
+//! Byte k of every value is written to stream k, the streams are written one after the other
+class BssEncoder {
+public:
+	BssEncoder(idx_t total_value_count_p, idx_t type_size_p)
+	    : total_value_count(total_value_count_p), type_size(type_size_p), count(0) {
+		buffer = make_unsafe_uniq_array<data_t>(total_value_count * type_size);
+	}
+
+public:
+	template <class T>
+	void WriteValue(T value) {
+		D_ASSERT(sizeof(T) == type_size && count < total_value_count);
+		const auto bytes = const_data_ptr_cast(&value);
+		for (idx_t byte_idx = 0; byte_idx < sizeof(T); byte_idx++) {
+			buffer[byte_idx * total_value_count + count] = bytes[byte_idx];
+		}
+		count++;
+	}
+
+	void FinishWrite(WriteStream &writer) {
+		D_ASSERT(count == total_value_count);
+		writer.WriteData(buffer.get(), total_value_count * type_size);
+	}
+
+private:
+	idx_t total_value_count;
+	//! The size of a value in bytes
+	idx_t type_size;
+	idx_t count;
+	unsafe_unique_array<data_t> buffer;
+};
+
+} // namespace duckdb
@@ -0,0 +1,209 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// parquet_dbp_encoder.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb.hpp"
+#ifndef DUCKDB_AMALGAMATION
+#include "duckdb/common/serializer/write_stream.hpp"
+#endif
+
+#include <type_traits>
+
+namespace duckdb {
+
+//! Encoder for the DELTA_BINARY_PACKED encoding, the counterpart of the DbpDecoder
+//! The deltas between consecutive values are computed with wrapping arithmetic on T, so they fit in the width of T
+//! Like the RleBpEncoder, the encoder can also be used to compute the encoded size without writing (Prepare)
+template <class T>
+class DbpEncoder {
+	using SIGNED = typename std::make_signed<T>::type;
+	using UNSIGNED = typename std::make_unsigned<T>::type;
+
+public:
+	static constexpr const idx_t BLOCK_SIZE_IN_VALUES = 128;
+	static constexpr const idx_t NUMBER_OF_MINIBLOCKS_IN_A_BLOCK = 4;
+	static constexpr const idx_t NUMBER_OF_VALUES_IN_A_MINIBLOCK =
+	    BLOCK_SIZE_IN_VALUES / NUMBER_OF_MINIBLOCKS_IN_A_BLOCK;
+
+public:
+	//! The total value count is written in the header, it is only required for writing
+	explicit DbpEncoder(idx_t total_value_count_p = 0)
+	    : total_value_count(total_value_count_p), value_count(0), previous_value(0), delta_count(0), byte_count(0) {
+	}
+
+public:
+	void BeginPrepare(T first_value) {
+		previous_value = first_value;
+		value_count = 1;
+		byte_count = GetVarintSize(IntToZigzag(int64_t(first_value)));
+	}
+	void PrepareValue(T value) {
+		AddValue(value);
+		if (delta_count == BLOCK_SIZE_IN_VALUES) {
+			PrepareBlock();
+		}
+	}
+	void FinishPrepare() {
+		if (delta_count > 0) {
+			PrepareBlock();
+		}
+	}
+	//! The size of the encoded values that were prepared
+	idx_t GetByteCount() const {
+		return byte_count + GetVarintSize(BLOCK_SIZE_IN_VALUES) + GetVarintSize(NUMBER_OF_MINIBLOCKS_IN_A_BLOCK) +
+		       GetVarintSize(value_count);
+	}
+
+	void BeginWrite(WriteStream &writer, T first_value) {
+		// <block size in values> <number of miniblocks in a block> <total value count> <first value>
+		VarintEncode(BLOCK_SIZE_IN_VALUES, writer);
+		VarintEncode(NUMBER_OF_MINIBLOCKS_IN_A_BLOCK, writer);
+		VarintEncode(total_value_count, writer);
+		VarintEncode(IntToZigzag(int64_t(first_value)), writer);
+		previous_value = first_value;
+		value_count = total_value_count == 0 ? 0 : 1;
+	}
+	void WriteValue(WriteStream &writer, T value) {
+		AddValue(value);
+		if (delta_count == BLOCK_SIZE_IN_VALUES) {
+			WriteBlock(writer);
+		}
+	}
+	void FinishWrite(WriteStream &writer) {
+		if (delta_count > 0) {
+			WriteBlock(writer);
+		}
+		D_ASSERT(value_count == total_value_count);
+	}
+
+private:
+	void AddValue(T value) {
+		deltas[delta_count++] = SIGNED(UNSIGNED(value) - UNSIGNED(previous_value));
+		previous_value = value;
+		value_count++;
+	}
+
+	//! Subtracts the minimum delta from the deltas of the block and computes the bit width of every miniblock
+	SIGNED FinalizeBlock() {
+		SIGNED min_delta = deltas[0];
+		for (idx_t i = 1; i < delta_count; i++) {
+			min_delta = MinValue(min_delta, deltas[i]);
+		}
+		for (idx_t i = 0; i < BLOCK_SIZE_IN_VALUES; i++) {
+			// padding values are zero
+			packed[i] = i < delta_count ? UNSIGNED(UNSIGNED(deltas[i]) - UNSIGNED(min_delta)) : 0;
+		}
+		for (idx_t miniblock_idx = 0; miniblock_idx < NUMBER_OF_MINIBLOCKS_IN_A_BLOCK; miniblock_idx++) {
+			// the bit widths of unneeded miniblocks are zero
+			UNSIGNED max_value = 0;
+			auto miniblock = packed + miniblock_idx * NUMBER_OF_VALUES_IN_A_MINIBLOCK;
+			for (idx_t i = 0; i < NUMBER_OF_VALUES_IN_A_MINIBLOCK; i++) {
+				max_value |= miniblock[i];
+			}
+			uint8_t width = 0;
+			while (max_value != 0) {
+				width++;
+				max_value >>= 1;
+			}
+			bit_widths[miniblock_idx] = width;
+		}
+		return min_delta;
+	}
+
+	void PrepareBlock() {
+		auto min_delta = FinalizeBlock();
+		byte_count += GetVarintSize(IntToZigzag(int64_t(min_delta))) + NUMBER_OF_MINIBLOCKS_IN_A_BLOCK;
+		for (idx_t miniblock_idx = 0; miniblock_idx < NUMBER_OF_MINIBLOCKS_IN_A_BLOCK; miniblock_idx++) {
+			byte_count += MiniblockSize(bit_widths[miniblock_idx]);
+		}
+		delta_count = 0;
+	}
+
+	void WriteBlock(WriteStream &writer) {
+		// <min delta> <list of bitwidths of miniblocks> <miniblocks>
+		auto min_delta = FinalizeBlock();
+		VarintEncode(IntToZigzag(int64_t(min_delta)), writer);
+		writer.WriteData(bit_widths, NUMBER_OF_MINIBLOCKS_IN_A_BLOCK);
+		for (idx_t miniblock_idx = 0; miniblock_idx < NUMBER_OF_MINIBLOCKS_IN_A_BLOCK; miniblock_idx++) {
+			if (miniblock_idx * NUMBER_OF_VALUES_IN_A_MINIBLOCK >= delta_count) {
+				// there are no miniblock bodies for the unneeded miniblocks of the last block
+				break;
+			}
+			BitPackMiniblock(writer, packed + miniblock_idx * NUMBER_OF_VALUES_IN_A_MINIBLOCK,
+			                 bit_widths[miniblock_idx]);
+		}
+		delta_count = 0;
+	}
+
+	//! Packs the values of a miniblock, starting from the least significant bit (like the RLE/bit-packing hybrid)
+	static void BitPackMiniblock(WriteStream &writer, const UNSIGNED *values, uint8_t width) {
+		data_t buffer[NUMBER_OF_VALUES_IN_A_MINIBLOCK * sizeof(UNSIGNED)];
+		const auto size = MiniblockSize(width);
+		memset(buffer, 0, size);
+		idx_t bit_offset = 0;
+		for (idx_t i = 0; i < NUMBER_OF_VALUES_IN_A_MINIBLOCK; i++) {
+			auto value = values[i];
+			idx_t remaining = width;
+			while (remaining > 0) {
+				const auto bit_idx = bit_offset % 8;
+				const auto bits = MinValue<idx_t>(8 - bit_idx, remaining);
+				buffer[bit_offset / 8] |= data_t((value & ((1U << bits) - 1)) << bit_idx);
+				value >>= bits;
+				remaining -= bits;
+				bit_offset += bits;
+			}
+		}
+		writer.WriteData(buffer, size);
+	}
+
+	static idx_t MiniblockSize(uint8_t width) {
+		return NUMBER_OF_VALUES_IN_A_MINIBLOCK * width / 8;
+	}
+
+	static uint64_t IntToZigzag(int64_t value) {
+		return (uint64_t(value) << 1) ^ uint64_t(value >> 63);
+	}
+
+	static void VarintEncode(uint64_t value, WriteStream &writer) {
+		do {
+			uint8_t byte = value & 127;
+			value >>= 7;
+			if (value != 0) {
+				byte |= 128;
+			}
+			writer.Write<uint8_t>(byte);
+		} while (value != 0);
+	}
+
+	static idx_t GetVarintSize(uint64_t value) {
+		idx_t result = 0;
+		do {
+			value >>= 7;
+			result++;
+		} while (value != 0);
+		return result;
+	}
+
+private:
+	idx_t total_value_count;
+	idx_t value_count;
+	T previous_value;
+
+	//! The deltas of the current block
+	SIGNED deltas[BLOCK_SIZE_IN_VALUES];
+	idx_t delta_count;
+	//! The deltas minus the minimum delta of the current block
+	UNSIGNED packed[BLOCK_SIZE_IN_VALUES];
+	uint8_t bit_widths[NUMBER_OF_MINIBLOCKS_IN_A_BLOCK];
+
+	//! The size of the prepared values (excluding the header)
+	idx_t byte_count;
+};
+
+} // namespace duckdb
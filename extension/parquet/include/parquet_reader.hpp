@@ -63,6 +63,9 @@ struct ParquetReaderScanState {
 
 	bool prefetch_mode = false;
 	bool current_group_prefetched = false;
+
+	//! Ranges of rows [start, end) of the current row group that the filters rule out based on the page index
+	vector<pair<idx_t, idx_t>> pruned_rows;
 };
 
 struct ParquetColumnDefinition {
@@ -162,6 +165,15 @@ private:
 	// Group span is the distance between the min page offset and the max page offset plus the max page compressed size
 	uint64_t GetGroupSpan(ParquetReaderScanState &state);
 	void PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t out_col_idx);
+	//! Whether or not the Bloom filter of the column chunk rules out all values the filter admits
+	bool BloomFilterExcludes(ParquetReaderScanState &state, const ColumnReader &column_reader,
+	                         const duckdb_parquet::format::ColumnChunk &column_chunk, const TableFilter &filter);
+	//! Adds the rows of the pages that the filter rules out based on the page index to the pruned rows
+	void PrunePages(ParquetReaderScanState &state, const ColumnReader &column_reader,
+	                const duckdb_parquet::format::ColumnChunk &column_chunk, TableFilter &filter);
+	//! Skips the pruned rows at the current offset (if any). Returns the number of rows that can be scanned before the
+	//! next pruned rows
+	idx_t SkipPrunedRows(ParquetReaderScanState &state, idx_t max_rows);
 	LogicalType DeriveLogicalType(const SchemaElement &s_ele);
 
 	template <typename... Args>
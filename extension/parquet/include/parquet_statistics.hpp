@@ -18,6 +18,9 @@ struct ParquetStatisticsUtils {
 
 	static unique_ptr<BaseStatistics> TransformColumnStatistics(const ColumnReader &reader,
 	                                                            const vector<ColumnChunk> &columns);
+	//! Transforms the statistics of a non-nested column, e.g., of a column chunk or a page
+	static unique_ptr<BaseStatistics>
+	TransformColumnStatistics(const ColumnReader &reader, const duckdb_parquet::format::Statistics &parquet_stats);
 
 	static Value ConvertValue(const LogicalType &type, const duckdb_parquet::format::SchemaElement &schema_ele,
 	                          const std::string &stats);
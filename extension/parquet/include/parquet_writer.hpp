@@ -36,6 +36,20 @@ struct PreparedRowGroup {
 	vector<shared_ptr<StringHeap>> heaps;
 };
 
+//! The page index of a column chunk, which is written before the footer
+struct ParquetPageIndex {
+	idx_t row_group_idx;
+	idx_t column_idx;
+	//! The column index is optional, e.g., if we have no statistics for the pages
+	unique_ptr<duckdb_parquet::format::ColumnIndex> column_index;
+	duckdb_parquet::format::OffsetIndex offset_index;
+};
+
+//! The version of the Parquet format we write
+//! V1 only uses the PLAIN and dictionary encodings, which every reader supports. V2 additionally uses the
+//! DELTA_BINARY_PACKED, DELTA_LENGTH_BYTE_ARRAY, DELTA_BYTE_ARRAY and BYTE_STREAM_SPLIT encodings
+enum class ParquetVersion : uint8_t { V1 = 1, V2 = 2 };
+
 struct FieldID;
 struct ChildFieldIDs {
 	ChildFieldIDs();
@@ -65,7 +79,7 @@ public:
 	              duckdb_parquet::format::CompressionCodec::type codec, ChildFieldIDs field_ids,
 	              const vector<pair<string, string>> &kv_metadata,
 	              shared_ptr<ParquetEncryptionConfig> encryption_config, double dictionary_compression_ratio_threshold,
-	              optional_idx compression_level);
+	              optional_idx compression_level, ParquetVersion parquet_version);
 
 public:
 	void PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGroup &result);
@@ -98,6 +112,16 @@ public:
 	optional_idx CompressionLevel() const {
 		return compression_level;
 	}
+	ParquetVersion GetParquetVersion() const {
+		return parquet_version;
+	}
+	//! Whether or not we write the page index and Bloom filters (we do not write them for encrypted files)
+	bool WriteIndexes() const {
+		return !encryption_config;
+	}
+	//! Adds the page index of a column chunk of the row group that is currently being flushed
+	void AddPageIndex(idx_t column_idx, unique_ptr<duckdb_parquet::format::ColumnIndex> column_index,
+	                  duckdb_parquet::format::OffsetIndex offset_index);
 
 	static CopyTypeSupport TypeIsSupported(const LogicalType &type);
 
@@ -107,6 +131,8 @@ public:
 private:
 	static CopyTypeSupport DuckDBTypeToParquetTypeInternal(const LogicalType &duckdb_type,
 	                                                       duckdb_parquet::format::Type::type &type);
+	void WritePageIndexes();
+
 	string file_name;
 	vector<LogicalType> sql_types;
 	vector<string> column_names;
@@ -115,6 +141,7 @@ private:
 	shared_ptr<ParquetEncryptionConfig> encryption_config;
 	double dictionary_compression_ratio_threshold;
 	optional_idx compression_level;
+	ParquetVersion parquet_version;
 
 	unique_ptr<BufferedFileWriter> writer;
 	std::shared_ptr<duckdb_apache::thrift::protocol::TProtocol> protocol;
@@ -122,6 +149,7 @@ private:
 	std::mutex lock;
 
 	vector<unique_ptr<ColumnWriter>> column_writers;
+	vector<ParquetPageIndex> page_indexes;
 };
 
 } // namespace duckdb
@@ -0,0 +1,192 @@
+#include "parquet_bloom_filter.hpp"
+
+#include "zstd/common/xxhash.h"
+
+namespace duckdb {
+
+using duckdb_apache::thrift::protocol::TProtocolException;
+using duckdb_apache::thrift::protocol::TType;
+
+//===--------------------------------------------------------------------===//
+// ParquetBloomFilterHeader
+//===--------------------------------------------------------------------===//
+bool ParquetBloomFilterHeader::IsSupported() const {
+	return block_algorithm && xxhash && uncompressed && num_bytes > 0 &&
+	       NumericCast<idx_t>(num_bytes) <= ParquetBloomFilter::MAX_BYTES &&
+	       NumericCast<idx_t>(num_bytes) % ParquetBloomFilter::BYTES_PER_BLOCK == 0;
+}
+
+//! Reads a union of empty structs, returns whether the first member is set
+static uint32_t ReadUnion(TProtocol *iprot, bool &first_member_set) {
+	uint32_t xfer = 0;
+	std::string fname;
+	TType ftype;
+	int16_t fid;
+
+	first_member_set = false;
+	xfer += iprot->readStructBegin(fname);
+	while (true) {
+		xfer += iprot->readFieldBegin(fname, ftype, fid);
+		if (ftype == duckdb_apache::thrift::protocol::T_STOP) {
+			break;
+		}
+		if (fid == 1 && ftype == duckdb_apache::thrift::protocol::T_STRUCT) {
+			first_member_set = true;
+		}
+		xfer += iprot->skip(ftype);
+		xfer += iprot->readFieldEnd();
+	}
+	xfer += iprot->readStructEnd();
+	return xfer;
+}
+
+//! Writes a union of empty structs with the first member set
+static uint32_t WriteUnion(TProtocol *oprot, const char *name, const char *member_name) {
+	uint32_t xfer = 0;
+	xfer += oprot->writeStructBegin(name);
+	xfer += oprot->writeFieldBegin(member_name, duckdb_apache::thrift::protocol::T_STRUCT, 1);
+	xfer += oprot->writeStructBegin(member_name);
+	xfer += oprot->writeFieldStop();
+	xfer += oprot->writeStructEnd();
+	xfer += oprot->writeFieldEnd();
+	xfer += oprot->writeFieldStop();
+	xfer += oprot->writeStructEnd();
+	return xfer;
+}
+
+uint32_t ParquetBloomFilterHeader::read(TProtocol *iprot) {
+	uint32_t xfer = 0;
+	std::string fname;
+	TType ftype;
+	int16_t fid;
+	bool isset_num_bytes = false;
+
+	xfer += iprot->readStructBegin(fname);
+	while (true) {
+		xfer += iprot->readFieldBegin(fname, ftype, fid);
+		if (ftype == duckdb_apache::thrift::protocol::T_STOP) {
+			break;
+		}
+		if (fid == 1 && ftype == duckdb_apache::thrift::protocol::T_I32) {
+			xfer += iprot->readI32(num_bytes);
+			isset_num_bytes = true;
+		} else if (fid == 2 && ftype == duckdb_apache::thrift::protocol::T_STRUCT) {
+			xfer += ReadUnion(iprot, block_algorithm);
+		} else if (fid == 3 && ftype == duckdb_apache::thrift::protocol::T_STRUCT) {
+			xfer += ReadUnion(iprot, xxhash);
+		} else if (fid == 4 && ftype == duckdb_apache::thrift::protocol::T_STRUCT) {
+			xfer += ReadUnion(iprot, uncompressed);
+		} else {
+			xfer += iprot->skip(ftype);
+		}
+		xfer += iprot->readFieldEnd();
+	}
+	xfer += iprot->readStructEnd();
+
+	if (!isset_num_bytes) {
+		throw TProtocolException(TProtocolException::INVALID_DATA);
+	}
+	return xfer;
+}
+
+uint32_t ParquetBloomFilterHeader::write(TProtocol *oprot) const {
+	D_ASSERT(block_algorithm && xxhash && uncompressed);
+	uint32_t xfer = 0;
+	xfer += oprot->writeStructBegin("BloomFilterHeader");
+
+	xfer += oprot->writeFieldBegin("numBytes", duckdb_apache::thrift::protocol::T_I32, 1);
+	xfer += oprot->writeI32(num_bytes);
+	xfer += oprot->writeFieldEnd();
+
+	xfer += oprot->writeFieldBegin("algorithm", duckdb_apache::thrift::protocol::T_STRUCT, 2);
+	xfer += WriteUnion(oprot, "BloomFilterAlgorithm", "BLOCK");
+	xfer += oprot->writeFieldEnd();
+
+	xfer += oprot->writeFieldBegin("hash", duckdb_apache::thrift::protocol::T_STRUCT, 3);
+	xfer += WriteUnion(oprot, "BloomFilterHash", "XXHASH");
+	xfer += oprot->writeFieldEnd();
+
+	xfer += oprot->writeFieldBegin("compression", duckdb_apache::thrift::protocol::T_STRUCT, 4);
+	xfer += WriteUnion(oprot, "BloomFilterCompression", "UNCOMPRESSED");
+	xfer += oprot->writeFieldEnd();
+
+	xfer += oprot->writeFieldStop();
+	xfer += oprot->writeStructEnd();
+	return xfer;
+}
+
+//===--------------------------------------------------------------------===//
+// ParquetBloomFilter
+//===--------------------------------------------------------------------===//
+//! The salts of the split-block Bloom filter, as given by the Parquet format
+static constexpr const uint32_t BLOOM_FILTER_SALT[] = {0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU,
+                                                       0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U};
+
+ParquetBloomFilter::ParquetBloomFilter(idx_t num_distinct_values) {
+	auto bytes = MaxValue<idx_t>(num_distinct_values * BITS_PER_VALUE / 8, BYTES_PER_BLOCK);
+	num_bytes = MinValue<idx_t>(NextPowerOfTwo(bytes), MAX_BYTES);
+	data = make_unsafe_uniq_array<data_t>(num_bytes);
+	memset(data.get(), 0, num_bytes);
+}
+
+ParquetBloomFilter::ParquetBloomFilter(unsafe_unique_array<data_t> data_p, idx_t num_bytes_p)
+    : data(std::move(data_p)), num_bytes(num_bytes_p) {
+	D_ASSERT(num_bytes > 0 && num_bytes % BYTES_PER_BLOCK == 0);
+}
+
+uint32_t *ParquetBloomFilter::GetBlock(uint64_t hash) const {
+	const auto block_count = num_bytes / BYTES_PER_BLOCK;
+	const auto block_idx = ((hash >> 32) * block_count) >> 32;
+	return reinterpret_cast<uint32_t *>(data.get() + block_idx * BYTES_PER_BLOCK);
+}
+
+void ParquetBloomFilter::Insert(uint64_t hash) {
+	auto block = GetBlock(hash);
+	const auto key = static_cast<uint32_t>(hash);
+	for (idx_t i = 0; i < 8; i++) {
+		block[i] |= 1U << ((key * BLOOM_FILTER_SALT[i]) >> 27);
+	}
+}
+
+bool ParquetBloomFilter::Contains(uint64_t hash) const {
+	auto block = GetBlock(hash);
+	const auto key = static_cast<uint32_t>(hash);
+	for (idx_t i = 0; i < 8; i++) {
+		if (!(block[i] & (1U << ((key * BLOOM_FILTER_SALT[i]) >> 27)))) {
+			return false;
+		}
+	}
+	return true;
+}
+
+uint64_t ParquetBloomFilter::Hash(const_data_ptr_t value, idx_t size) {
+	return duckdb_zstd::XXH64(value, size, 0);
+}
+
+void ParquetBloomFilter::Write(TProtocol &oprot) const {
+	ParquetBloomFilterHeader header;
+	header.num_bytes = NumericCast<int32_t>(num_bytes);
+	header.block_algorithm = true;
+	header.xxhash = true;
+	header.uncompressed = true;
+	header.write(&oprot);
+	oprot.getTransport()->write(data.get(), NumericCast<uint32_t>(num_bytes));
+}
+
+unique_ptr<ParquetBloomFilter> ParquetBloomFilter::Read(TProtocol &iprot, optional_idx length) {
+	ParquetBloomFilterHeader header;
+	auto header_size = header.read(&iprot);
+	if (!header.IsSupported()) {
+		return nullptr;
+	}
+	auto bytes = NumericCast<idx_t>(header.num_bytes);
+	if (length.IsValid() && header_size + bytes > length.GetIndex()) {
+		// the Bloom filter does not fit in the length given in the metadata
+		return nullptr;
+	}
+	auto data = make_unsafe_uniq_array<data_t>(bytes);
+	iprot.getTransport()->readAll(data.get(), NumericCast<uint32_t>(bytes));
+	return make_uniq<ParquetBloomFilter>(std::move(data), bytes);
+}
+
+} // namespace duckdb
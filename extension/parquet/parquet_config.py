@@ -20,6 +20,7 @@ source_files = [
     for x in [
         'extension/parquet/column_reader.cpp',
         'extension/parquet/column_writer.cpp',
+        'extension/parquet/parquet_bloom_filter.cpp',
         'extension/parquet/parquet_crypto.cpp',
         'extension/parquet/parquet_extension.cpp',
         'extension/parquet/parquet_metadata.cpp',
@@ -71,5 +72,3 @@ source_files += [
         'third_party/zstd/compress/zstd_opt.cpp',
     ]
 ]
-# lz4
-source_files += [os.path.sep.join(x.split('/')) for x in ['third_party/lz4/lz4.cpp']]
@@ -162,6 +162,8 @@ struct ParquetWriteBindData : public TableFunctionData {
 	ChildFieldIDs field_ids;
 	//! The compression level, higher value is more
 	optional_idx compression_level;
+	//! The version of the Parquet format, which determines the encodings we can use
+	ParquetVersion parquet_version = ParquetVersion::V1;
 };
 
 struct ParquetWriteGlobalState : public GlobalFunctionData {
@@ -365,6 +367,7 @@ public:
 		table_function.projection_pushdown = true;
 		table_function.filter_pushdown = true;
 		table_function.filter_prune = true;
+		table_function.dynamic_filter_pushdown = true;
 		table_function.pushdown_complex_filter = ParquetComplexFilterPushdown;
 
 		MultiFileReader::AddParameters(table_function);
@@ -1144,6 +1147,15 @@ unique_ptr<FunctionData> ParquetWriteBind(ClientContext &context, CopyFunctionBi
 			bind_data->dictionary_compression_ratio_threshold = val;
 		} else if (loption == "compression_level") {
 			bind_data->compression_level = option.second[0].GetValue<uint64_t>();
+		} else if (loption == "parquet_version") {
+			const auto roption = StringUtil::Upper(option.second[0].ToString());
+			if (roption == "V1") {
+				bind_data->parquet_version = ParquetVersion::V1;
+			} else if (roption == "V2") {
+				bind_data->parquet_version = ParquetVersion::V2;
+			} else {
+				throw BinderException("Expected %s argument to be either [V1, V2]", loption);
+			}
 		} else {
 			throw NotImplementedException("Unrecognized option for PARQUET: %s", option.first.c_str());
 		}
@@ -1172,7 +1184,8 @@ unique_ptr<GlobalFunctionData> ParquetWriteInitializeGlobal(ClientContext &conte
 	global_state->writer = make_uniq<ParquetWriter>(
 	    fs, file_path, parquet_bind.sql_types, parquet_bind.column_names, parquet_bind.codec,
 	    parquet_bind.field_ids.Copy(), parquet_bind.kv_metadata, parquet_bind.encryption_config,
-	    parquet_bind.dictionary_compression_ratio_threshold, parquet_bind.compression_level);
+	    parquet_bind.dictionary_compression_ratio_threshold, parquet_bind.compression_level,
+	    parquet_bind.parquet_version);
 	return std::move(global_state);
 }
 
@@ -1294,6 +1307,9 @@ static void ParquetCopySerialize(Serializer &serializer, const FunctionData &bin
 	serializer.WriteProperty(108, "dictionary_compression_ratio_threshold",
 	                         bind_data.dictionary_compression_ratio_threshold);
 	serializer.WritePropertyWithDefault<optional_idx>(109, "compression_level", bind_data.compression_level);
+	serializer.WritePropertyWithDefault<uint8_t>(110, "parquet_version",
+	                                             static_cast<uint8_t>(bind_data.parquet_version),
+	                                             static_cast<uint8_t>(ParquetVersion::V1));
 }
 
 static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserializer, CopyFunction &function) {
@@ -1310,6 +1326,8 @@ static unique_ptr<FunctionData> ParquetCopyDeserialize(Deserializer &deserialize
 	deserializer.ReadPropertyWithDefault<double>(108, "dictionary_compression_ratio_threshold",
 	                                             data->dictionary_compression_ratio_threshold, 1.0);
 	deserializer.ReadPropertyWithDefault<optional_idx>(109, "compression_level", data->compression_level);
+	data->parquet_version = static_cast<ParquetVersion>(deserializer.ReadPropertyWithDefault<uint8_t>(
+	    110, "parquet_version", static_cast<uint8_t>(ParquetVersion::V1)));
 	return std::move(data);
 }
 // LCOV_EXCL_STOP
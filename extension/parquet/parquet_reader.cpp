@@ -6,6 +6,7 @@
 #include "column_reader.hpp"
 #include "duckdb.hpp"
 #include "list_column_reader.hpp"
+#include "parquet_bloom_filter.hpp"
 #include "parquet_crypto.hpp"
 #include "parquet_file_metadata_cache.hpp"
 #include "parquet_statistics.hpp"
@@ -25,6 +26,7 @@
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/planner/table_filter.hpp"
@@ -665,6 +667,17 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 				state.group_offset = group.num_rows;
 				return;
 			}
+			// the Bloom filter and the page index are only available for columns without nesting
+			auto file_idx = column_reader->FileIdx();
+			if (!parquet_options.encryption_config && column_reader->MaxRepeat() == 0 &&
+			    column_reader->Schema().__isset.type && file_idx < group.columns.size()) {
+				auto &column_chunk = group.columns[file_idx];
+				if (BloomFilterExcludes(state, *column_reader, column_chunk, filter)) {
+					state.group_offset = group.num_rows;
+					return;
+				}
+				PrunePages(state, *column_reader, column_chunk, filter);
+			}
 		}
 	}
 
@@ -672,6 +685,184 @@ void ParquetReader::PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t c
 	                                  *state.thrift_file_proto);
 }
 
+//! Whether or not the filter only admits values that are equal to a constant
+static bool IsBloomFilterCandidate(const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON:
+		return filter.Cast<ConstantFilter>().comparison_type == ExpressionType::COMPARE_EQUAL;
+	case TableFilterType::CONJUNCTION_AND: {
+		for (auto &child_filter : filter.Cast<ConjunctionAndFilter>().child_filters) {
+			if (IsBloomFilterCandidate(*child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		for (auto &child_filter : filter.Cast<ConjunctionOrFilter>().child_filters) {
+			if (!IsBloomFilterCandidate(*child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+//! Hashes a value like it is hashed for the Bloom filter: the hash of its plain encoding in the file
+static bool HashBloomFilterValue(const ColumnReader &column_reader, const Value &value, uint64_t &hash) {
+	auto &type = column_reader.Type();
+	if (value.IsNull() || value.type() != type) {
+		return false;
+	}
+	switch (column_reader.Schema().type) {
+	case Type::BYTE_ARRAY:
+		if (type.id() != LogicalTypeId::VARCHAR && type.id() != LogicalTypeId::BLOB) {
+			return false;
+		}
+		hash = ParquetBloomFilter::Hash(const_data_ptr_cast(StringValue::Get(value).c_str()),
+		                                StringValue::Get(value).size());
+		return true;
+	case Type::INT32:
+		// other types (e.g., DATE or DECIMAL) are converted when reading
+		if (type.id() != LogicalTypeId::INTEGER) {
+			return false;
+		}
+		hash = ParquetBloomFilter::Hash<int32_t>(IntegerValue::Get(value));
+		return true;
+	case Type::INT64:
+		if (type.id() != LogicalTypeId::BIGINT) {
+			return false;
+		}
+		hash = ParquetBloomFilter::Hash<int64_t>(BigIntValue::Get(value));
+		return true;
+	default:
+		return false;
+	}
+}
+
+static bool BloomFilterExcludesInternal(const ParquetBloomFilter &bloom_filter, const ColumnReader &column_reader,
+                                        const TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::CONSTANT_COMPARISON: {
+		auto &constant_filter = filter.Cast<ConstantFilter>();
+		uint64_t hash;
+		if (constant_filter.comparison_type != ExpressionType::COMPARE_EQUAL ||
+		    !HashBloomFilterValue(column_reader, constant_filter.constant, hash)) {
+			return false;
+		}
+		return !bloom_filter.Contains(hash);
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		for (auto &child_filter : filter.Cast<ConjunctionAndFilter>().child_filters) {
+			if (BloomFilterExcludesInternal(bloom_filter, column_reader, *child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		for (auto &child_filter : filter.Cast<ConjunctionOrFilter>().child_filters) {
+			if (!BloomFilterExcludesInternal(bloom_filter, column_reader, *child_filter)) {
+				return false;
+			}
+		}
+		return true;
+	}
+	default:
+		return false;
+	}
+}
+
+bool ParquetReader::BloomFilterExcludes(ParquetReaderScanState &state, const ColumnReader &column_reader,
+                                        const ColumnChunk &column_chunk, const TableFilter &filter) {
+	auto &meta_data = column_chunk.meta_data;
+	if (!meta_data.__isset.bloom_filter_offset || meta_data.bloom_filter_offset <= 0 ||
+	    !IsBloomFilterCandidate(filter)) {
+		return false;
+	}
+	optional_idx length;
+	if (meta_data.__isset.bloom_filter_length) {
+		length = NumericCast<idx_t>(meta_data.bloom_filter_length);
+	}
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
+	trans.SetLocation(NumericCast<idx_t>(meta_data.bloom_filter_offset));
+	auto bloom_filter = ParquetBloomFilter::Read(*state.thrift_file_proto, length);
+	if (!bloom_filter) {
+		return false;
+	}
+	return BloomFilterExcludesInternal(*bloom_filter, column_reader, filter);
+}
+
+void ParquetReader::PrunePages(ParquetReaderScanState &state, const ColumnReader &column_reader,
+                               const ColumnChunk &column_chunk, TableFilter &filter) {
+	if (!column_chunk.__isset.column_index_offset || !column_chunk.__isset.offset_index_offset) {
+		return;
+	}
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
+	duckdb_parquet::format::ColumnIndex column_index;
+	trans.SetLocation(NumericCast<idx_t>(column_chunk.column_index_offset));
+	column_index.read(state.thrift_file_proto.get());
+	duckdb_parquet::format::OffsetIndex offset_index;
+	trans.SetLocation(NumericCast<idx_t>(column_chunk.offset_index_offset));
+	offset_index.read(state.thrift_file_proto.get());
+
+	auto &pages = offset_index.page_locations;
+	auto page_count = pages.size();
+	if (page_count <= 1 || column_index.null_pages.size() != page_count ||
+	    column_index.min_values.size() != page_count || column_index.max_values.size() != page_count) {
+		return;
+	}
+	auto has_null_counts = column_index.__isset.null_counts && column_index.null_counts.size() == page_count;
+	auto num_rows = NumericCast<idx_t>(GetGroup(state).num_rows);
+	for (idx_t page_idx = 0; page_idx < page_count; page_idx++) {
+		auto page_start = NumericCast<idx_t>(pages[page_idx].first_row_index);
+		auto page_end = page_idx + 1 < page_count ? NumericCast<idx_t>(pages[page_idx + 1].first_row_index) : num_rows;
+		if (page_start >= page_end || page_end > num_rows) {
+			// the offset index is not valid
+			return;
+		}
+		unique_ptr<BaseStatistics> page_stats;
+		if (column_index.null_pages[page_idx]) {
+			// the page only contains NULL values
+			page_stats = BaseStatistics::CreateEmpty(column_reader.Type()).ToUnique();
+			page_stats->Set(StatsInfo::CAN_HAVE_NULL_VALUES);
+		} else {
+			Statistics parquet_stats;
+			parquet_stats.__set_min_value(column_index.min_values[page_idx]);
+			parquet_stats.__set_max_value(column_index.max_values[page_idx]);
+			if (has_null_counts) {
+				parquet_stats.__set_null_count(column_index.null_counts[page_idx]);
+			}
+			page_stats = ParquetStatisticsUtils::TransformColumnStatistics(column_reader, parquet_stats);
+		}
+		if (page_stats && filter.CheckStatistics(*page_stats) == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+			state.pruned_rows.emplace_back(page_start, page_end);
+		}
+	}
+}
+
+idx_t ParquetReader::SkipPrunedRows(ParquetReaderScanState &state, idx_t max_rows) {
+	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+	for (auto &range : state.pruned_rows) {
+		if (range.first <= state.group_offset && state.group_offset < range.second) {
+			// the rows at the current offset are pruned: skip them in all columns
+			auto skip_count = range.second - state.group_offset;
+			for (idx_t col_idx = 0; col_idx < reader_data.column_ids.size(); col_idx++) {
+				root_reader.GetChildReader(reader_data.column_ids[col_idx])->Skip(skip_count);
+			}
+			state.group_offset += skip_count;
+			return 0;
+		}
+		if (range.first > state.group_offset) {
+			max_rows = MinValue<idx_t>(max_rows, range.first - state.group_offset);
+		}
+	}
+	return max_rows;
+}
+
 idx_t ParquetReader::NumRows() {
 	return GetFileMetadata()->num_rows;
 }
@@ -829,6 +1020,27 @@ static void FilterOperationSwitch(Vector &v, Value &constant, parquet_filter_t &
 	}
 }
 
+static void FilterBloom(Vector &v, const DynamicFilterData &filter_data, parquet_filter_t &filter_mask, idx_t count) {
+	if (filter_mask.none() || count == 0) {
+		return;
+	}
+	SelectionVector sel(STANDARD_VECTOR_SIZE);
+	idx_t sel_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		if (filter_mask[i]) {
+			sel.set_index(sel_count++, i);
+		}
+	}
+	auto remaining = filter_data.FilterBloom(v, sel, sel_count);
+	if (remaining == sel_count) {
+		return;
+	}
+	filter_mask.reset();
+	for (idx_t i = 0; i < remaining; i++) {
+		filter_mask.set(sel.get_index(i));
+	}
+}
+
 static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter_mask, idx_t count) {
 	switch (filter.filter_type) {
 	case TableFilterType::CONJUNCTION_AND: {
@@ -883,6 +1095,17 @@ static void ApplyFilter(Vector &v, TableFilter &filter, parquet_filter_t &filter
 		auto &child = StructVector::GetEntries(v)[struct_filter.child_idx];
 		ApplyFilter(*child, *struct_filter.child_filter, filter_mask, count);
 	} break;
+	case TableFilterType::DYNAMIC_FILTER: {
+		auto &filter_data = *filter.Cast<DynamicFilter>().filter_data;
+		if (!filter_data.initialized) {
+			break;
+		}
+		auto range_filter = filter_data.GetFilter();
+		if (range_filter) {
+			ApplyFilter(v, *range_filter, filter_mask, count);
+		}
+		FilterBloom(v, filter_data, filter_mask, count);
+	} break;
 	default:
 		D_ASSERT(0);
 		break;
@@ -907,6 +1130,7 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 	if (state.current_group < 0 || (int64_t)state.group_offset >= GetGroup(state).num_rows) {
 		state.current_group++;
 		state.group_offset = 0;
+		state.pruned_rows.clear();
 
 		auto &trans = reinterpret_cast<ThriftFileTransport &>(*state.thrift_file_proto->getTransport());
 		trans.ClearPrefetch();
@@ -978,12 +1202,19 @@ bool ParquetReader::ScanInternal(ParquetReaderScanState &state, DataChunk &resul
 	}
 
 	auto this_output_chunk_rows = MinValue<idx_t>(STANDARD_VECTOR_SIZE, GetGroup(state).num_rows - state.group_offset);
-	result.SetCardinality(this_output_chunk_rows);
-
 	if (this_output_chunk_rows == 0) {
+		result.SetCardinality(0);
 		state.finished = true;
 		return false; // end of last group, we are done
 	}
+	if (!state.pruned_rows.empty()) {
+		this_output_chunk_rows = SkipPrunedRows(state, this_output_chunk_rows);
+	}
+	result.SetCardinality(this_output_chunk_rows);
+	if (this_output_chunk_rows == 0) {
+		// we skipped pruned rows
+		return true;
+	}
 
 	// we evaluate simple table filters directly in this scan so we can skip decoding column data that's never going to
 	// be relevant
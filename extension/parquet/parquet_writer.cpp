@@ -353,10 +353,12 @@ ParquetWriter::ParquetWriter(FileSystem &fs, string file_name_p, vector<LogicalT
                              CompressionCodec::type codec, ChildFieldIDs field_ids_p,
                              const vector<pair<string, string>> &kv_metadata,
                              shared_ptr<ParquetEncryptionConfig> encryption_config_p,
-                             double dictionary_compression_ratio_threshold_p, optional_idx compression_level_p)
+                             double dictionary_compression_ratio_threshold_p, optional_idx compression_level_p,
+                             ParquetVersion parquet_version_p)
     : file_name(std::move(file_name_p)), sql_types(std::move(types_p)), column_names(std::move(names_p)), codec(codec),
       field_ids(std::move(field_ids_p)), encryption_config(std::move(encryption_config_p)),
-      dictionary_compression_ratio_threshold(dictionary_compression_ratio_threshold_p) {
+      dictionary_compression_ratio_threshold(dictionary_compression_ratio_threshold_p),
+      parquet_version(parquet_version_p) {
 	// initialize the file writer
 	writer = make_uniq<BufferedFileWriter>(fs, file_name.c_str(),
 	                                       FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
@@ -373,7 +375,7 @@ ParquetWriter::ParquetWriter(FileSystem &fs, string file_name_p, vector<LogicalT
 	protocol = tproto_factory.getProtocol(std::make_shared<MyTransport>(*writer));
 
 	file_meta_data.num_rows = 0;
-	file_meta_data.version = 1;
+	file_meta_data.version = static_cast<int32_t>(parquet_version);
 
 	file_meta_data.__isset.created_by = true;
 	file_meta_data.created_by = "DuckDB";
@@ -554,7 +556,42 @@ void ParquetWriter::Flush(ColumnDataCollection &buffer) {
 	FlushRowGroup(prepared_row_group);
 }
 
+void ParquetWriter::AddPageIndex(idx_t column_idx, unique_ptr<duckdb_parquet::format::ColumnIndex> column_index,
+                                 duckdb_parquet::format::OffsetIndex offset_index) {
+	// this is called while flushing a row group (i.e., holding the lock), before it is added to the file meta data
+	ParquetPageIndex page_index;
+	page_index.row_group_idx = file_meta_data.row_groups.size();
+	page_index.column_idx = column_idx;
+	page_index.column_index = std::move(column_index);
+	page_index.offset_index = std::move(offset_index);
+	page_indexes.push_back(std::move(page_index));
+}
+
+void ParquetWriter::WritePageIndexes() {
+	// all column indexes are written first, followed by all offset indexes
+	for (auto &page_index : page_indexes) {
+		if (!page_index.column_index) {
+			continue;
+		}
+		auto &column_chunk = file_meta_data.row_groups[page_index.row_group_idx].columns[page_index.column_idx];
+		auto offset = writer->GetTotalWritten();
+		Write(*page_index.column_index);
+		column_chunk.__set_column_index_offset(NumericCast<int64_t>(offset));
+		column_chunk.__set_column_index_length(NumericCast<int32_t>(writer->GetTotalWritten() - offset));
+	}
+	for (auto &page_index : page_indexes) {
+		auto &column_chunk = file_meta_data.row_groups[page_index.row_group_idx].columns[page_index.column_idx];
+		auto offset = writer->GetTotalWritten();
+		Write(page_index.offset_index);
+		column_chunk.__set_offset_index_offset(NumericCast<int64_t>(offset));
+		column_chunk.__set_offset_index_length(NumericCast<int32_t>(writer->GetTotalWritten() - offset));
+	}
+	page_indexes.clear();
+}
+
 void ParquetWriter::Finalize() {
+	WritePageIndexes();
+
 	auto start_offset = writer->GetTotalWritten();
 	if (encryption_config) {
 		// Crypto metadata is written unencrypted
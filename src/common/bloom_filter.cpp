@@ -0,0 +1,56 @@
+#include "duckdb/common/bloom_filter.hpp"
+
+namespace duckdb {
+
+BloomFilter::BloomFilter(idx_t expected_count) {
+	block_count = NextPowerOfTwo(MaxValue<idx_t>(expected_count * BITS_PER_ENTRY / 64, 1));
+	blocks = make_unsafe_uniq_array<atomic<uint64_t>>(block_count);
+	for (idx_t i = 0; i < block_count; i++) {
+		blocks[i].store(0, std::memory_order_relaxed);
+	}
+}
+
+void BloomFilter::Insert(Vector &hashes, idx_t count) {
+	D_ASSERT(hashes.GetType().id() == LogicalType::HASH);
+	UnifiedVectorFormat hdata;
+	hashes.ToUnifiedFormat(count, hdata);
+	const auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+	for (idx_t i = 0; i < count; i++) {
+		const auto hash = hash_data[hdata.sel->get_index(i)];
+		blocks[GetBlockIndex(hash)].fetch_or(GetMask(hash), std::memory_order_relaxed);
+	}
+}
+
+void BloomFilter::Insert(const hash_t *hashes, idx_t count) {
+	for (idx_t i = 0; i < count; i++) {
+		blocks[GetBlockIndex(hashes[i])].fetch_or(GetMask(hashes[i]), std::memory_order_relaxed);
+	}
+}
+
+idx_t BloomFilter::Filter(Vector &hashes, const SelectionVector &sel, idx_t count, SelectionVector &result) const {
+	D_ASSERT(hashes.GetType().id() == LogicalType::HASH);
+	UnifiedVectorFormat hdata;
+	hashes.ToUnifiedFormat(count, hdata);
+	const auto hash_data = UnifiedVectorFormat::GetData<hash_t>(hdata);
+
+	// no branches: this loop is bound by the (random) accesses into the blocks
+	idx_t result_count = 0;
+	for (idx_t i = 0; i < count; i++) {
+		const auto idx = sel.get_index(i);
+		result.set_index(result_count, idx);
+		result_count += Lookup(hash_data[hdata.sel->get_index(idx)]);
+	}
+	return result_count;
+}
+
+idx_t BloomFilter::Filter(Vector &hashes, SelectionVector &sel, idx_t count) const {
+	D_ASSERT(count <= STANDARD_VECTOR_SIZE);
+	SelectionVector result_sel(STANDARD_VECTOR_SIZE);
+	const auto result_count = Filter(hashes, sel, count, result_sel);
+	if (result_count != count) {
+		sel.Initialize(result_sel);
+	}
+	return result_count;
+}
+
+} // namespace duckdb
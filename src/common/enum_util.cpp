@@ -4857,6 +4857,8 @@ const char* EnumUtil::ToChars<PhysicalOperatorType>(PhysicalOperatorType value)
 		return "EXPRESSION_SCAN";
 	case PhysicalOperatorType::POSITIONAL_SCAN:
 		return "POSITIONAL_SCAN";
+	case PhysicalOperatorType::TABLE_FETCH:
+		return "TABLE_FETCH";
 	case PhysicalOperatorType::BLOCKWISE_NL_JOIN:
 		return "BLOCKWISE_NL_JOIN";
 	case PhysicalOperatorType::NESTED_LOOP_JOIN:
@@ -4877,6 +4879,8 @@ const char* EnumUtil::ToChars<PhysicalOperatorType>(PhysicalOperatorType value)
 		return "POSITIONAL_JOIN";
 	case PhysicalOperatorType::ASOF_JOIN:
 		return "ASOF_JOIN";
+	case PhysicalOperatorType::INDEX_JOIN:
+		return "INDEX_JOIN";
 	case PhysicalOperatorType::UNION:
 		return "UNION";
 	case PhysicalOperatorType::RECURSIVE_CTE:
@@ -5047,6 +5051,9 @@ PhysicalOperatorType EnumUtil::FromString<PhysicalOperatorType>(const char *valu
 	if (StringUtil::Equals(value, "POSITIONAL_SCAN")) {
 		return PhysicalOperatorType::POSITIONAL_SCAN;
 	}
+	if (StringUtil::Equals(value, "TABLE_FETCH")) {
+		return PhysicalOperatorType::TABLE_FETCH;
+	}
 	if (StringUtil::Equals(value, "BLOCKWISE_NL_JOIN")) {
 		return PhysicalOperatorType::BLOCKWISE_NL_JOIN;
 	}
@@ -5077,6 +5084,9 @@ PhysicalOperatorType EnumUtil::FromString<PhysicalOperatorType>(const char *valu
 	if (StringUtil::Equals(value, "ASOF_JOIN")) {
 		return PhysicalOperatorType::ASOF_JOIN;
 	}
+	if (StringUtil::Equals(value, "INDEX_JOIN")) {
+		return PhysicalOperatorType::INDEX_JOIN;
+	}
 	if (StringUtil::Equals(value, "UNION")) {
 		return PhysicalOperatorType::UNION;
 	}
@@ -6782,6 +6792,8 @@ const char* EnumUtil::ToChars<TableFilterType>(TableFilterType value) {
 		return "CONJUNCTION_AND";
 	case TableFilterType::STRUCT_EXTRACT:
 		return "STRUCT_EXTRACT";
+	case TableFilterType::DYNAMIC_FILTER:
+		return "DYNAMIC_FILTER";
 	default:
 		throw NotImplementedException(StringUtil::Format("Enum value: '%d' not implemented", value));
 	}
@@ -6807,6 +6819,9 @@ TableFilterType EnumUtil::FromString<TableFilterType>(const char *value) {
 	if (StringUtil::Equals(value, "STRUCT_EXTRACT")) {
 		return TableFilterType::STRUCT_EXTRACT;
 	}
+	if (StringUtil::Equals(value, "DYNAMIC_FILTER")) {
+		return TableFilterType::DYNAMIC_FILTER;
+	}
 	throw NotImplementedException(StringUtil::Format("Enum value: '%s' not implemented", value));
 }
 
@@ -7416,6 +7431,8 @@ const char* EnumUtil::ToChars<WALType>(WALType value) {
 		return "DELETE_TUPLE";
 	case WALType::UPDATE_TUPLE:
 		return "UPDATE_TUPLE";
+	case WALType::COMPRESSED_INSERT_TUPLE:
+		return "COMPRESSED_INSERT_TUPLE";
 	case WALType::WAL_VERSION:
 		return "WAL_VERSION";
 	case WALType::CHECKPOINT:
@@ -7498,6 +7515,9 @@ WALType EnumUtil::FromString<WALType>(const char *value) {
 	if (StringUtil::Equals(value, "UPDATE_TUPLE")) {
 		return WALType::UPDATE_TUPLE;
 	}
+	if (StringUtil::Equals(value, "COMPRESSED_INSERT_TUPLE")) {
+		return WALType::COMPRESSED_INSERT_TUPLE;
+	}
 	if (StringUtil::Equals(value, "WAL_VERSION")) {
 		return WALType::WAL_VERSION;
 	}
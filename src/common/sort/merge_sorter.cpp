@@ -10,14 +10,24 @@ MergeSorter::MergeSorter(GlobalSortState &state, BufferManager &buffer_manager)
 
 void MergeSorter::PerformInMergeRound() {
 	while (true) {
+		bool merge_group;
 		{
 			lock_guard<mutex> pair_guard(state.lock);
 			if (state.pair_idx == state.num_pairs) {
 				break;
 			}
-			GetNextPartition();
+			merge_group = state.merge_fan_in > 2;
+			if (merge_group) {
+				GetNextGroup();
+			} else {
+				GetNextPartition();
+			}
+		}
+		if (merge_group) {
+			MergeGroup();
+		} else {
+			MergePartition();
 		}
-		MergePartition();
 	}
 }
 
@@ -130,6 +140,177 @@ void MergeSorter::GetNextPartition() {
 	}
 }
 
+void MergeSorter::GetNextGroup() {
+	// Create result block
+	state.sorted_blocks_temp[state.pair_idx].push_back(make_uniq<SortedBlock>(buffer_manager, state));
+	result = state.sorted_blocks_temp[state.pair_idx].back().get();
+	// The blocks are divided evenly over the groups, every group has at least two blocks
+	const idx_t block_count = state.sorted_blocks.size();
+	const idx_t begin = state.pair_idx * block_count / state.num_pairs;
+	const idx_t end = (state.pair_idx + 1) * block_count / state.num_pairs;
+	D_ASSERT(end - begin >= 2);
+	run_inputs.clear();
+	for (idx_t block_idx = begin; block_idx < end; block_idx++) {
+		run_inputs.push_back(std::move(state.sorted_blocks[block_idx]));
+	}
+	// Advance group
+	state.pair_idx++;
+}
+
+void MergeSorter::MergeGroup() {
+	// Initialize a reader for every run
+	const idx_t run_count = run_inputs.size();
+	idx_t count = 0;
+	runs.clear();
+	for (auto &run_input : run_inputs) {
+		count += run_input->Count();
+		runs.push_back(make_uniq<SBScanState>(buffer_manager, state));
+		runs.back()->sb = run_input.get();
+		runs.back()->SetIndices(0, 0);
+	}
+	for (idx_t run_idx = 0; run_idx < run_count; run_idx++) {
+		PinRun(run_idx);
+	}
+	// Build the loser tree: the inner nodes initially hold a sentinel that comes before every run,
+	// which is pushed out of the tree by the runs that are inserted
+	loser_tree.assign(run_count, run_count);
+	for (idx_t run_idx = run_count; run_idx > 0; run_idx--) {
+		AdjustLoserTree(run_idx - 1);
+	}
+	// Merge loop: the root of the loser tree holds the run with the smallest entry
+	writer = make_uniq<SBScanState>(buffer_manager, state);
+	writer->sb = result;
+	for (idx_t merged = 0; merged < count; merged++) {
+		if (merged % state.block_capacity == 0) {
+			// Like Merge Path, we write blocks with exactly state.block_capacity rows or less
+			result->InitializeWrite();
+			writer->SetIndices(result->radix_sorting_data.size() - 1, 0);
+		}
+		const auto winner = loser_tree[0];
+		PopRun(winner);
+		PinRun(winner);
+		AdjustLoserTree(winner);
+	}
+	D_ASSERT(result->Count() == count);
+	writer.reset();
+	runs.clear();
+	run_inputs.clear();
+}
+
+bool MergeSorter::RunIsSmaller(idx_t l, idx_t r) {
+	const idx_t run_count = runs.size();
+	if (l == run_count || r == run_count) {
+		// The sentinel comes before everything
+		return l == run_count && r != run_count;
+	}
+	auto &l_run = *runs[l];
+	auto &r_run = *runs[r];
+	const bool l_done = l_run.block_idx == l_run.sb->radix_sorting_data.size();
+	const bool r_done = r_run.block_idx == r_run.sb->radix_sorting_data.size();
+	if (l_done || r_done) {
+		return !l_done;
+	}
+	int comp_res;
+	if (sort_layout.all_constant) {
+		comp_res = FastMemcmp(l_run.RadixPtr(), r_run.RadixPtr(), sort_layout.comparison_size);
+	} else {
+		comp_res = Comparators::CompareTuple(l_run, r_run, l_run.RadixPtr(), r_run.RadixPtr(), sort_layout,
+		                                     state.external);
+	}
+	// Break ties using the run index, so the merge is stable
+	return comp_res < 0 || (comp_res == 0 && l < r);
+}
+
+void MergeSorter::AdjustLoserTree(idx_t run_idx) {
+	// The leaf of run 'i' is at (virtual) position run_count + i, the inner nodes store the loser of their match
+	const idx_t run_count = runs.size();
+	idx_t winner = run_idx;
+	for (idx_t node = (run_idx + run_count) / 2; node > 0; node /= 2) {
+		if (RunIsSmaller(loser_tree[node], winner)) {
+			std::swap(loser_tree[node], winner);
+		}
+	}
+	loser_tree[0] = winner;
+}
+
+void MergeSorter::PinRun(idx_t run_idx) {
+	auto &run = *runs[run_idx];
+	auto &sb = *run.sb;
+	auto &blocks = sb.radix_sorting_data;
+	// Move to the next block (if needed)
+	while (run.block_idx < blocks.size() && run.entry_idx == blocks[run.block_idx]->count) {
+		// Delete references to previous block
+		blocks[run.block_idx]->block = nullptr;
+		if (!sort_layout.all_constant) {
+			sb.blob_sorting_data->data_blocks[run.block_idx]->block = nullptr;
+			if (!sort_layout.blob_layout.AllConstant() && state.external) {
+				sb.blob_sorting_data->heap_blocks[run.block_idx]->block = nullptr;
+			}
+		}
+		sb.payload_data->data_blocks[run.block_idx]->block = nullptr;
+		if (!state.payload_layout.AllConstant() && state.external) {
+			sb.payload_data->heap_blocks[run.block_idx]->block = nullptr;
+		}
+		// Advance block
+		run.block_idx++;
+		run.entry_idx = 0;
+	}
+	if (run.block_idx == blocks.size()) {
+		// Exhausted
+		return;
+	}
+	// Pin the data that is needed for comparisons
+	run.PinRadix(run.block_idx);
+	if (!sort_layout.all_constant) {
+		run.PinData(*sb.blob_sorting_data);
+	}
+}
+
+void MergeSorter::PopRun(idx_t run_idx) {
+	auto &run = *runs[run_idx];
+	auto &out = *writer;
+	// Copy the radix sorting data
+	out.PinRadix(out.block_idx);
+	FastMemcpy(out.RadixPtr(), run.RadixPtr(), sort_layout.entry_size);
+	result->radix_sorting_data[out.block_idx]->count++;
+	// The blob sorting data and payload
+	if (!sort_layout.all_constant) {
+		CopyRunRow(run, *run.sb->blob_sorting_data, *result->blob_sorting_data);
+	}
+	CopyRunRow(run, *run.sb->payload_data, *result->payload_data);
+	// Advance
+	out.entry_idx++;
+	run.entry_idx++;
+}
+
+void MergeSorter::CopyRunRow(SBScanState &run, SortedData &source_data, SortedData &result_data) {
+	auto &out = *writer;
+	const auto &layout = result_data.layout;
+	run.PinData(source_data);
+	out.PinData(result_data);
+	const data_ptr_t source_ptr = run.DataPtr(source_data);
+	const data_ptr_t target_ptr = out.DataPtr(result_data);
+	FastMemcpy(target_ptr, source_ptr, layout.GetRowWidth());
+	if (!layout.AllConstant() && state.external) {
+		// Copy the heap row, and store its offset in the result heap block in the row
+		const data_ptr_t source_heap_ptr = run.HeapPtr(source_data);
+		const auto entry_size = Load<uint32_t>(source_heap_ptr);
+		D_ASSERT(entry_size >= sizeof(uint32_t));
+		auto &heap_block = *result_data.heap_blocks[out.block_idx];
+		if (heap_block.byte_offset + entry_size > heap_block.capacity) {
+			// Reallocate result heap block size
+			const idx_t new_capacity = MaxValue(heap_block.capacity * 2, heap_block.byte_offset + entry_size);
+			buffer_manager.ReAllocate(heap_block.block, new_capacity);
+			heap_block.capacity = new_capacity;
+		}
+		memcpy(out.BaseHeapPtr(result_data) + heap_block.byte_offset, source_heap_ptr, entry_size);
+		Store<idx_t>(heap_block.byte_offset, target_ptr + layout.GetHeapOffset());
+		heap_block.byte_offset += entry_size;
+		heap_block.count++;
+	}
+	result_data.data_blocks[out.block_idx]->count++;
+}
+
 int MergeSorter::CompareUsingGlobalIndex(SBScanState &l, SBScanState &r, const idx_t l_idx, const idx_t r_idx) {
 	D_ASSERT(l_idx < l.sb->Count());
 	D_ASSERT(r_idx < r.sb->Count());
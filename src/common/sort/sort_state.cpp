@@ -3,6 +3,7 @@
 #include "duckdb/common/row_operations/row_operations.hpp"
 #include "duckdb/common/sort/sort.hpp"
 #include "duckdb/common/sort/sorted_block.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/storage/buffer/buffer_pool.hpp"
 
 #include <algorithm>
@@ -363,7 +364,7 @@ void LocalSortState::ReOrder(GlobalSortState &gstate, bool reorder_heap) {
 GlobalSortState::GlobalSortState(BufferManager &buffer_manager, const vector<BoundOrderByNode> &orders,
                                  RowLayout &payload_layout)
     : buffer_manager(buffer_manager), sort_layout(SortLayout(orders)), payload_layout(payload_layout),
-      block_capacity(0), external(false) {
+      block_capacity(0), external(false), merge_fan_in(2) {
 }
 
 void GlobalSortState::AddLocalState(LocalSortState &local_sort_state) {
@@ -434,14 +435,20 @@ void GlobalSortState::InitializeMergeRound() {
 	// If we reverse this list, the blocks that were merged last will be merged first in the next round
 	// These are still in memory, therefore this reduces the amount of read/write to disk!
 	std::reverse(sorted_blocks.begin(), sorted_blocks.end());
-	// Uneven number of blocks - keep one on the side
-	if (sorted_blocks.size() % 2 == 1) {
-		odd_one_out = std::move(sorted_blocks.back());
-		sorted_blocks.pop_back();
+	merge_fan_in = ComputeMergeFanIn();
+	if (merge_fan_in > 2) {
+		// Every task merges a group of (at least two) blocks at once
+		num_pairs = (sorted_blocks.size() + merge_fan_in - 1) / merge_fan_in;
+	} else {
+		// Uneven number of blocks - keep one on the side
+		if (sorted_blocks.size() % 2 == 1) {
+			odd_one_out = std::move(sorted_blocks.back());
+			sorted_blocks.pop_back();
+		}
+		num_pairs = sorted_blocks.size() / 2;
 	}
 	// Init merge path path indices
 	pair_idx = 0;
-	num_pairs = sorted_blocks.size() / 2;
 	l_start = 0;
 	r_start = 0;
 	// Allocate room for merge results
@@ -450,6 +457,36 @@ void GlobalSortState::InitializeMergeRound() {
 	}
 }
 
+idx_t GlobalSortState::ComputeMergeFanIn() const {
+	// Merge Path divides the merge of a pair of blocks evenly over all threads, which is the best choice in memory.
+	// An external sort reads and writes all data once per round though, so we reduce the number of rounds by merging
+	// more blocks at once. A k-way merge pins the current block of every input, which must fit in memory
+	if (!external) {
+		return 2;
+	}
+	idx_t max_block_size = 1;
+	for (auto &sb : sorted_blocks) {
+		if (!sb->radix_sorting_data.empty()) {
+			max_block_size = MaxValue(max_block_size, sb->SizeInBytes() / sb->radix_sorting_data.size());
+		}
+	}
+	auto &scheduler = TaskScheduler::GetScheduler(buffer_manager.GetDatabase());
+	const auto num_threads = NumericCast<idx_t>(scheduler.NumberOfThreads());
+	const idx_t pinnable_blocks = buffer_manager.GetQueryMaxMemory() / 2 / max_block_size;
+	for (idx_t fan_in = SortConstants::MAX_MERGE_FAN_IN; fan_in >= 4; fan_in /= 2) {
+		if (sorted_blocks.size() <= fan_in) {
+			// The final rounds are left to Merge Path, so that all threads participate
+			continue;
+		}
+		// Every group that is merged concurrently pins one block per input, and one output block
+		const idx_t num_groups = (sorted_blocks.size() + fan_in - 1) / fan_in;
+		if (MinValue(num_groups, num_threads) * (fan_in + 1) <= pinnable_blocks) {
+			return fan_in;
+		}
+	}
+	return 2;
+}
+
 void GlobalSortState::CompleteMergeRound(bool keep_radix_data) {
 	sorted_blocks.clear();
 	for (auto &sorted_block_vector : sorted_blocks_temp) {
@@ -40,7 +40,8 @@ GroupedAggregateHashTable::GroupedAggregateHashTable(ClientContext &context, All
                                                      vector<AggregateObject> aggregate_objects_p,
                                                      idx_t initial_capacity, idx_t radix_bits)
     : BaseAggregateHashTable(context, allocator, aggregate_objects_p, std::move(payload_types_p)),
-      radix_bits(radix_bits), count(0), capacity(0), aggregate_allocator(make_shared_ptr<ArenaAllocator>(allocator)) {
+      radix_bits(radix_bits), count(0), skip_lookups(false), capacity(0),
+      aggregate_allocator(make_shared_ptr<ArenaAllocator>(allocator)) {
 
 	// Append hash column to the end and initialise the row layout
 	group_types_p.emplace_back(LogicalType::HASH);
@@ -161,6 +162,14 @@ void GroupedAggregateHashTable::ResetCount() {
 	count = 0;
 }
 
+void GroupedAggregateHashTable::SetSkipLookups(bool skip_lookups_p) {
+	skip_lookups = skip_lookups_p;
+}
+
+bool GroupedAggregateHashTable::SkipLookups() const {
+	return skip_lookups;
+}
+
 void GroupedAggregateHashTable::SetRadixBits(idx_t radix_bits_p) {
 	radix_bits = radix_bits_p;
 }
@@ -313,7 +322,7 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 	D_ASSERT(state.hash_salts.GetType() == LogicalType::HASH);
 
 	// Need to fit the entire vector, and resize at threshold
-	if (Count() + groups.size() > capacity || Count() + groups.size() > ResizeThreshold()) {
+	if (!skip_lookups && (Count() + groups.size() > capacity || Count() + groups.size() > ResizeThreshold())) {
 		Verify();
 		Resize(capacity * 2);
 	}
@@ -358,6 +367,30 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 	}
 	TupleDataCollection::GetVectorData(chunk_state, state.group_data.get());
 
+	if (skip_lookups) {
+		// Append every row as a new group, duplicate groups are combined later on
+		const auto &incremental_sel = *FlatVector::IncrementalSelectionVector();
+		partitioned_data->AppendUnified(state.append_state, state.group_chunk, incremental_sel, groups.size());
+		RowOperations::InitializeStates(layout, chunk_state.row_locations, incremental_sel, groups.size());
+
+		const auto row_locations = FlatVector::GetData<data_ptr_t>(chunk_state.row_locations);
+		const auto &row_sel = state.append_state.reverse_partition_sel;
+		for (idx_t i = 0; i < groups.size(); i++) {
+			addresses[i] = row_locations[row_sel.get_index(i)];
+			new_groups_out.set_index(i, i);
+		}
+		return groups.size();
+	}
+
+	// Random accesses to a large pointer table miss the cache: issue the loads for the whole vector up front, so
+	// that they overlap instead of stalling the probing loop one by one
+	const auto prefetch = capacity * sizeof(aggr_ht_entry_t) > PREFETCH_THRESHOLD;
+	if (prefetch) {
+		for (idx_t r = 0; r < groups.size(); r++) {
+			PrefetchMemory(entries + ht_offsets[r]);
+		}
+	}
+
 	idx_t new_group_count = 0;
 	idx_t remaining_entries = groups.size();
 	idx_t iteration_count;
@@ -429,6 +462,12 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 				const auto &entry = entries[ht_offsets[index]];
 				addresses[index] = entry.GetPointer();
 			}
+			if (prefetch) {
+				// The rows are compared column by column, prefetch them before comparing the first column
+				for (idx_t need_compare_idx = 0; need_compare_idx < need_compare_count; need_compare_idx++) {
+					PrefetchMemory(addresses[state.group_compare_vector.get_index(need_compare_idx)]);
+				}
+			}
 
 			// Perform group comparisons
 			row_matcher.Match(state.group_chunk, chunk_state.vector_data, state.group_compare_vector,
@@ -380,7 +380,7 @@ void GetChildSections(vector<KeySection> &child_sections, vector<ARTKey> &keys,
 	child_sections.emplace_back(child_start_idx, key_section.end, keys, key_section);
 }
 
-bool Construct(ART &art, vector<ARTKey> &keys, row_t *row_ids, Node &node, KeySection &key_section,
+bool Construct(ART &art, vector<ARTKey> &keys, const row_t *row_ids, Node &node, KeySection &key_section,
                bool &has_constraint) {
 
 	D_ASSERT(key_section.start < keys.size());
@@ -447,12 +447,9 @@ bool Construct(ART &art, vector<ARTKey> &keys, row_t *row_ids, Node &node, KeySe
 	return true;
 }
 
-bool ART::ConstructFromSorted(idx_t count, vector<ARTKey> &keys, Vector &row_identifiers) {
-
-	// prepare the row_identifiers
-	row_identifiers.Flatten(count);
-	auto row_ids = FlatVector::GetData<row_t>(row_identifiers);
+bool ART::ConstructFromSorted(idx_t count, vector<ARTKey> &keys, const row_t *row_ids) {
 
+	D_ASSERT(!tree.HasMetadata());
 	auto key_section = KeySection(0, count - 1, 0, 0);
 	auto has_constraint = IsUnique();
 	if (!Construct(*this, keys, row_ids, tree, key_section, has_constraint)) {
@@ -787,19 +784,20 @@ bool ART::SearchEqual(ARTKey &key, idx_t max_count, vector<row_t> &result_ids) {
 	return Leaf::GetRowIds(*this, *leaf, result_ids, max_count);
 }
 
-void ART::SearchEqualJoinNoFetch(ARTKey &key, idx_t &result_size) {
-
-	// we need to look for a leaf
-	auto leaf_node = Lookup(tree, key, 0);
-	if (!leaf_node) {
-		result_size = 0;
-		return;
+void ART::SearchEqualJoin(const vector<ARTKey> &keys, idx_t count, vector<row_t> &result_ids,
+                          vector<idx_t> &key_indexes) {
+	D_ASSERT(keys.size() >= count);
+	lock_guard<mutex> l(lock);
+	vector<optional_ptr<const Node>> leaves;
+	Lookup(keys, count, leaves);
+	for (idx_t i = 0; i < count; i++) {
+		auto leaf = leaves[i];
+		if (!leaf) {
+			continue;
+		}
+		Leaf::GetRowIds(*this, *leaf, result_ids, NumericLimits<idx_t>::Maximum());
+		key_indexes.resize(result_ids.size(), i);
 	}
-
-	// we only perform index joins on PK/FK columns
-	D_ASSERT(leaf_node->GetType() == NType::LEAF_INLINED);
-	result_size = 1;
-	return;
 }
 
 //===--------------------------------------------------------------------===//
@@ -840,6 +838,94 @@ optional_ptr<const Node> ART::Lookup(const Node &node, const ARTKey &key, idx_t
 	return nullptr;
 }
 
+//! The state of a single key lookup of a batched lookup
+struct ARTBatchLookupState {
+	//! The index of the key
+	idx_t key_idx;
+	//! The next node to traverse
+	const Node *node;
+	//! The depth of the next node
+	idx_t depth;
+};
+
+void ART::Lookup(const vector<ARTKey> &keys, idx_t count, vector<optional_ptr<const Node>> &leaves) {
+	D_ASSERT(keys.size() >= count);
+
+	// a lookup traverses the tree by chasing pointers, i.e., it mostly waits for its next node to be loaded into the
+	// cache. We interleave the lookups of several keys: each lookup prefetches its next node, and then yields to the
+	// other lookups, so that the cache misses of the lookups overlap
+	static constexpr idx_t LOOKUP_BATCH_SIZE = 16;
+
+	leaves.assign(count, nullptr);
+	if (!tree.HasMetadata()) {
+		return;
+	}
+
+	ARTBatchLookupState lookups[LOOKUP_BATCH_SIZE];
+	idx_t active_count = 0;
+	idx_t next_key = 0;
+	while (true) {
+		// start the lookups of the next keys
+		while (active_count < LOOKUP_BATCH_SIZE && next_key < count) {
+			if (keys[next_key].Empty()) {
+				next_key++;
+				continue;
+			}
+			auto &lookup = lookups[active_count++];
+			lookup.key_idx = next_key++;
+			lookup.node = &tree;
+			lookup.depth = 0;
+			tree.Prefetch(*this, keys[lookup.key_idx][0]);
+		}
+		if (active_count == 0) {
+			break;
+		}
+
+		// advance each lookup by one node
+		for (idx_t i = 0; i < active_count;) {
+			auto &lookup = lookups[i];
+			auto &key = keys[lookup.key_idx];
+			auto &node = *lookup.node;
+
+			optional_ptr<const Node> next_node;
+			switch (node.GetType()) {
+			case NType::PREFIX: {
+				auto &prefix = Node::Ref<const Prefix>(*this, node, NType::PREFIX);
+				next_node = &prefix.ptr;
+				for (idx_t byte_idx = 0; byte_idx < prefix.data[Node::PREFIX_SIZE]; byte_idx++) {
+					if (prefix.data[byte_idx] != key[lookup.depth]) {
+						// the prefix does not match the key
+						next_node = nullptr;
+						break;
+					}
+					lookup.depth++;
+				}
+				break;
+			}
+			case NType::LEAF:
+			case NType::LEAF_INLINED:
+				leaves[lookup.key_idx] = &node;
+				break;
+			default:
+				D_ASSERT(lookup.depth < key.len);
+				next_node = node.GetChild(*this, key[lookup.depth]);
+				lookup.depth++;
+				break;
+			}
+
+			if (!next_node) {
+				// the lookup is finished, replace it with the last active lookup
+				lookups[i] = lookups[--active_count];
+				continue;
+			}
+			D_ASSERT(next_node->HasMetadata());
+			lookup.node = next_node.get();
+			next_node->Prefetch(*this, lookup.depth < key.len ? key[lookup.depth] : 0);
+			i++;
+		}
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Greater Than and Less Than
 //===--------------------------------------------------------------------===//
@@ -980,6 +1066,24 @@ bool ART::Scan(const Transaction &transaction, const DataTable &table, IndexScan
 	return true;
 }
 
+bool ART::ScanOrdered(const bool descending, const idx_t max_count, vector<row_t> &result_ids) {
+
+	lock_guard<mutex> l(lock);
+	if (!tree.HasMetadata()) {
+		return true;
+	}
+
+	// the iterator does not outlive the lock, as concurrent changes to the ART invalidate its stack of nodes
+	Iterator it;
+	it.art = this;
+	if (descending) {
+		it.FindMaximum(tree);
+	} else {
+		it.FindMinimum(tree);
+	}
+	return it.ScanOrdered(max_count, result_ids, descending);
+}
+
 //===--------------------------------------------------------------------===//
 // More Verification / Constraint Checking
 //===--------------------------------------------------------------------===//
@@ -1045,6 +1149,10 @@ void ART::CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_m
 	vector<ARTKey> keys(expression_chunk.size());
 	GenerateKeys(arena_allocator, expression_chunk, keys);
 
+	// look up all keys at once, which is faster than looking them up one by one
+	vector<optional_ptr<const Node>> leaves;
+	Lookup(keys, input.size(), leaves);
+
 	idx_t found_conflict = DConstants::INVALID_INDEX;
 	for (idx_t i = 0; found_conflict == DConstants::INVALID_INDEX && i < input.size(); i++) {
 
@@ -1055,7 +1163,7 @@ void ART::CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_m
 			continue;
 		}
 
-		auto leaf = Lookup(tree, keys[i], 0);
+		auto leaf = leaves[i];
 		if (!leaf) {
 			if (conflict_manager.AddMiss(i)) {
 				found_conflict = i;
@@ -1087,6 +1195,8 @@ void ART::CheckConstraintsForChunk(DataChunk &input, ConflictManager &conflict_m
 //===--------------------------------------------------------------------===//
 
 IndexStorageInfo ART::GetStorageInfo(const bool get_buffers) {
+	// a background checkpoint serializes the index while other transactions look up keys to verify their appends
+	lock_guard<mutex> l(lock);
 
 	// set the name and root node
 	IndexStorageInfo info;
@@ -71,6 +71,23 @@ bool Iterator::Scan(const ARTKey &upper_bound, const idx_t max_count, vector<row
 	return true;
 }
 
+bool Iterator::ScanOrdered(const idx_t max_count, vector<row_t> &result_ids, const bool descending) {
+
+	while (true) {
+		// copy all row IDs of this leaf into the result IDs, the leaf is never split up
+		Leaf::GetRowIds(*art, last_leaf, result_ids, NumericLimits<idx_t>::Maximum());
+
+		// get the next leaf
+		auto has_next = descending ? Prev() : Next();
+		if (!has_next) {
+			return true;
+		}
+		if (result_ids.size() >= max_count) {
+			return false;
+		}
+	}
+}
+
 void Iterator::FindMinimum(const Node &node) {
 
 	D_ASSERT(node.HasMetadata());
@@ -100,6 +117,35 @@ void Iterator::FindMinimum(const Node &node) {
 	FindMinimum(*next);
 }
 
+void Iterator::FindMaximum(const Node &node) {
+
+	D_ASSERT(node.HasMetadata());
+
+	// found the maximum
+	if (node.GetType() == NType::LEAF || node.GetType() == NType::LEAF_INLINED) {
+		last_leaf = node;
+		return;
+	}
+
+	// traverse the prefix
+	if (node.GetType() == NType::PREFIX) {
+		auto &prefix = Node::Ref<const Prefix>(*art, node, NType::PREFIX);
+		for (idx_t i = 0; i < prefix.data[Node::PREFIX_SIZE]; i++) {
+			current_key.Push(prefix.data[i]);
+		}
+		nodes.emplace(node, 0);
+		return FindMaximum(prefix.ptr);
+	}
+
+	// go to the rightmost entry in the current node and recurse
+	uint8_t byte = NumericLimits<uint8_t>::Maximum();
+	auto prev = node.GetPrevChild(*art, byte);
+	D_ASSERT(prev);
+	current_key.Push(byte);
+	nodes.emplace(node, byte);
+	FindMaximum(*prev);
+}
+
 bool Iterator::LowerBound(const Node &node, const ARTKey &key, const bool equal, idx_t depth) {
 
 	if (!node.HasMetadata()) {
@@ -197,6 +243,40 @@ bool Iterator::Next() {
 	return false;
 }
 
+bool Iterator::Prev() {
+
+	while (!nodes.empty()) {
+
+		auto &top = nodes.top();
+		D_ASSERT(top.node.GetType() != NType::LEAF && top.node.GetType() != NType::LEAF_INLINED);
+
+		if (top.node.GetType() == NType::PREFIX) {
+			PopNode();
+			continue;
+		}
+
+		if (top.byte == 0) {
+			// no node found: move up the tree, pop key byte of current node
+			PopNode();
+			continue;
+		}
+
+		top.byte--;
+		auto prev_node = top.node.GetPrevChild(*art, top.byte);
+		if (!prev_node) {
+			PopNode();
+			continue;
+		}
+
+		current_key.Pop(1);
+		current_key.Push(top.byte);
+
+		FindMaximum(*prev_node);
+		return true;
+	}
+	return false;
+}
+
 void Iterator::PopNode() {
 	if (nodes.top().node.GetType() == NType::PREFIX) {
 		auto &prefix = Node::Ref<const Prefix>(*art, nodes.top().node, NType::PREFIX);
@@ -160,6 +160,31 @@ optional_ptr<const Node> Node::GetChild(ART &art, const uint8_t byte) const {
 	}
 }
 
+void Node::Prefetch(ART &art, const uint8_t byte) const {
+
+	D_ASSERT(HasMetadata());
+
+	switch (GetType()) {
+	case NType::PREFIX:
+		return PrefetchMemory(&Ref<const Prefix>(art, *this, NType::PREFIX));
+	case NType::LEAF:
+		return PrefetchMemory(&Ref<const Leaf>(art, *this, NType::LEAF));
+	case NType::NODE_4:
+		return PrefetchMemory(&Ref<const Node4>(art, *this, NType::NODE_4));
+	case NType::NODE_16:
+		return PrefetchMemory(&Ref<const Node16>(art, *this, NType::NODE_16));
+	case NType::NODE_48:
+		return PrefetchMemory(&Ref<const Node48>(art, *this, NType::NODE_48).child_index[byte]);
+	case NType::NODE_256:
+		return PrefetchMemory(&Ref<const Node256>(art, *this, NType::NODE_256).children[byte]);
+	case NType::LEAF_INLINED:
+		// the row ID is stored in the node itself
+		return;
+	default:
+		throw InternalException("Invalid node type for Prefetch.");
+	}
+}
+
 optional_ptr<Node> Node::GetChildMutable(ART &art, const uint8_t byte) const {
 
 	D_ASSERT(HasMetadata());
@@ -214,6 +239,24 @@ optional_ptr<Node> Node::GetNextChildMutable(ART &art, uint8_t &byte) const {
 	}
 }
 
+optional_ptr<const Node> Node::GetPrevChild(ART &art, uint8_t &byte) const {
+
+	D_ASSERT(HasMetadata());
+
+	switch (GetType()) {
+	case NType::NODE_4:
+		return Ref<const Node4>(art, *this, NType::NODE_4).GetPrevChild(byte);
+	case NType::NODE_16:
+		return Ref<const Node16>(art, *this, NType::NODE_16).GetPrevChild(byte);
+	case NType::NODE_48:
+		return Ref<const Node48>(art, *this, NType::NODE_48).GetPrevChild(byte);
+	case NType::NODE_256:
+		return Ref<const Node256>(art, *this, NType::NODE_256).GetPrevChild(byte);
+	default:
+		throw InternalException("Invalid node type for GetPrevChild.");
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Utility
 //===--------------------------------------------------------------------===//
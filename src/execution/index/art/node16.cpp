@@ -186,6 +186,17 @@ optional_ptr<Node> Node16::GetNextChildMutable(uint8_t &byte) {
 	return nullptr;
 }
 
+optional_ptr<const Node> Node16::GetPrevChild(uint8_t &byte) const {
+	for (idx_t i = count; i > 0; i--) {
+		if (key[i - 1] <= byte) {
+			byte = key[i - 1];
+			D_ASSERT(children[i - 1].HasMetadata());
+			return &children[i - 1];
+		}
+	}
+	return nullptr;
+}
+
 void Node16::Vacuum(ART &art, const ARTFlags &flags) {
 
 	for (idx_t i = 0; i < count; i++) {
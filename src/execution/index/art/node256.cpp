@@ -126,6 +126,16 @@ optional_ptr<Node> Node256::GetNextChildMutable(uint8_t &byte) {
 	return nullptr;
 }
 
+optional_ptr<const Node> Node256::GetPrevChild(uint8_t &byte) const {
+	for (idx_t i = idx_t(byte) + 1; i > 0; i--) {
+		if (children[i - 1].HasMetadata()) {
+			byte = UnsafeNumericCast<uint8_t>(i - 1);
+			return &children[i - 1];
+		}
+	}
+	return nullptr;
+}
+
 void Node256::Vacuum(ART &art, const ARTFlags &flags) {
 
 	for (idx_t i = 0; i < Node::NODE_256_CAPACITY; i++) {
@@ -186,6 +186,17 @@ optional_ptr<Node> Node48::GetNextChildMutable(uint8_t &byte) {
 	return nullptr;
 }
 
+optional_ptr<const Node> Node48::GetPrevChild(uint8_t &byte) const {
+	for (idx_t i = idx_t(byte) + 1; i > 0; i--) {
+		if (child_index[i - 1] != Node::EMPTY_MARKER) {
+			byte = UnsafeNumericCast<uint8_t>(i - 1);
+			D_ASSERT(children[child_index[i - 1]].HasMetadata());
+			return &children[child_index[i - 1]];
+		}
+	}
+	return nullptr;
+}
+
 void Node48::Vacuum(ART &art, const ARTFlags &flags) {
 
 	for (idx_t i = 0; i < Node::NODE_256_CAPACITY; i++) {
@@ -18,7 +18,8 @@ JoinHashTable::JoinHashTable(BufferManager &buffer_manager_p, const vector<JoinC
                              vector<LogicalType> btypes, JoinType type_p, const vector<idx_t> &output_columns_p)
     : buffer_manager(buffer_manager_p), conditions(conditions_p), build_types(std::move(btypes)),
       output_columns(output_columns_p), entry_size(0), tuple_size(0), vfound(Value::BOOLEAN(false)), join_type(type_p),
-      finalized(false), has_null(false), radix_bits(INITIAL_RADIX_BITS), partition_start(0), partition_end(0) {
+      finalized(false), has_null(false), bloom_filter_probe(false), bloom_filter_probe_count(0),
+      bloom_filter_pass_count(0), radix_bits(INITIAL_RADIX_BITS), partition_start(0), partition_end(0) {
 
 	for (auto &condition : conditions) {
 		D_ASSERT(condition.left->return_type == condition.right->return_type);
@@ -321,6 +322,9 @@ void JoinHashTable::Finalize(idx_t chunk_idx_from, idx_t chunk_idx_to, bool para
 		for (idx_t i = 0; i < count; i++) {
 			hash_data[i] = Load<hash_t>(row_locations[i] + pointer_offset);
 		}
+		if (bloom_filter) {
+			bloom_filter->Insert(hash_data, count);
+		}
 		InsertHashes(hashes, count, row_locations, parallel);
 	} while (iterator.Next());
 }
@@ -344,6 +348,21 @@ unique_ptr<ScanStructure> JoinHashTable::InitializeScanStructure(DataChunk &keys
 	return ss;
 }
 
+idx_t JoinHashTable::ProbeBloomFilter(Vector &hashes, const SelectionVector &sel, idx_t count,
+                                      SelectionVector &result) {
+	D_ASSERT(bloom_filter);
+	const auto result_count = bloom_filter->Filter(hashes, sel, count, result);
+
+	// stop checking the Bloom filter if it turns out that most keys pass it anyway
+	const auto probe_count = bloom_filter_probe_count.fetch_add(count) + count;
+	const auto pass_count = bloom_filter_pass_count.fetch_add(result_count) + result_count;
+	if (probe_count >= BLOOM_FILTER_SAMPLE_COUNT &&
+	    double(pass_count) > double(probe_count) * BLOOM_FILTER_MAX_PASS_RATE) {
+		bloom_filter_probe = false;
+	}
+	return result_count;
+}
+
 unique_ptr<ScanStructure> JoinHashTable::Probe(DataChunk &keys, TupleDataChunkState &key_state,
                                                Vector *precomputed_hashes) {
 	const SelectionVector *current_sel;
@@ -352,17 +371,25 @@ unique_ptr<ScanStructure> JoinHashTable::Probe(DataChunk &keys, TupleDataChunkSt
 		return ss;
 	}
 
-	if (precomputed_hashes) {
-		ApplyBitmask(*precomputed_hashes, *current_sel, ss->count, ss->pointers);
-	} else {
+	Vector hashes(LogicalType::HASH);
+	if (!precomputed_hashes) {
 		// hash all the keys
-		Vector hashes(LogicalType::HASH);
 		Hash(keys, *current_sel, ss->count, hashes);
+		precomputed_hashes = &hashes;
+	}
 
-		// now initialize the pointers of the scan structure based on the hashes
-		ApplyBitmask(hashes, *current_sel, ss->count, ss->pointers);
+	if (bloom_filter_probe) {
+		// keys that do not pass the Bloom filter have no match, we do not need to look them up in the HT
+		ss->count = ProbeBloomFilter(*precomputed_hashes, *current_sel, ss->count, ss->sel_vector);
+		current_sel = &ss->sel_vector;
+		if (ss->count == 0) {
+			return ss;
+		}
 	}
 
+	// now initialize the pointers of the scan structure based on the hashes
+	ApplyBitmask(*precomputed_hashes, *current_sel, ss->count, ss->pointers);
+
 	// create the selection vector linking to only non-empty entries
 	ss->InitializeSelectionVector(current_sel);
 
@@ -8,7 +8,23 @@
 
 namespace duckdb {
 
-bool PhysicalStreamingWindow::IsStreamingFunction(unique_ptr<Expression> &expr) {
+idx_t PhysicalStreamingWindow::GetSlidingFrameSize(ClientContext &context, BoundWindowExpression &wexpr) {
+	if (wexpr.start != WindowBoundary::EXPR_PRECEDING_ROWS || wexpr.end != WindowBoundary::CURRENT_ROW_ROWS ||
+	    !wexpr.start_expr->IsFoldable()) {
+		return DConstants::INVALID_INDEX;
+	}
+	Value offset;
+	if (!ExpressionExecutor::TryEvaluateScalar(context, *wexpr.start_expr, offset) || offset.IsNull()) {
+		return DConstants::INVALID_INDEX;
+	}
+	const auto preceding = offset.GetValue<int64_t>();
+	if (preceding < 0 || preceding >= int64_t(MAX_SLIDING_FRAME_SIZE)) {
+		return DConstants::INVALID_INDEX;
+	}
+	return idx_t(preceding) + 1;
+}
+
+bool PhysicalStreamingWindow::IsStreamingFunction(ClientContext &context, unique_ptr<Expression> &expr) {
 	auto &wexpr = expr->Cast<BoundWindowExpression>();
 	if (!wexpr.partitions.empty() || !wexpr.orders.empty() || wexpr.ignore_nulls ||
 	    wexpr.exclude_clause != WindowExcludeMode::NO_OTHER) {
@@ -19,8 +35,15 @@ bool PhysicalStreamingWindow::IsStreamingFunction(unique_ptr<Expression> &expr)
 	case ExpressionType::WINDOW_AGGREGATE:
 		// We can stream aggregates if they are "running totals"
 		// TODO: Support FILTER and DISTINCT
-		return wexpr.start == WindowBoundary::UNBOUNDED_PRECEDING && wexpr.end == WindowBoundary::CURRENT_ROW_ROWS &&
-		       !wexpr.filter_expr && !wexpr.distinct;
+		if (wexpr.filter_expr || wexpr.distinct) {
+			return false;
+		}
+		if (wexpr.start == WindowBoundary::UNBOUNDED_PRECEDING && wexpr.end == WindowBoundary::CURRENT_ROW_ROWS) {
+			return true;
+		}
+		// Or if they slide over a constant number of rows, and the aggregate can combine states
+		return (wexpr.children.empty() || wexpr.aggregate->combine) &&
+		       GetSlidingFrameSize(context, wexpr) != DConstants::INVALID_INDEX;
 	case ExpressionType::WINDOW_FIRST_VALUE:
 	case ExpressionType::WINDOW_PERCENT_RANK:
 	case ExpressionType::WINDOW_RANK:
@@ -46,6 +69,104 @@ public:
 	std::atomic<int64_t> row_number;
 };
 
+//! Aggregates the last frame_size rows, using a queue of two stacks that needs an amortised constant number
+//! of combines per row. The front stack holds the oldest rows, where every row holds the aggregate of itself and the
+//! later rows of the front stack. The back stack holds the newer rows, and their aggregate.
+class StreamingSlidingAggregate {
+public:
+	StreamingSlidingAggregate(AggregateFunction &aggregate, FunctionData *bind_data, ArenaAllocator &allocator,
+	                          idx_t frame_size)
+	    : aggregate(aggregate), bind_data(bind_data), allocator(allocator), frame_size(frame_size),
+	      state_size(aggregate.state_size()), states(frame_size * state_size), back(state_size),
+	      frame(state_size), first(0), split(0), next(0), sourcev(LogicalType::POINTER, data_ptr_cast(&source_ptr)),
+	      targetv(LogicalType::POINTER, data_ptr_cast(&target_ptr)) {
+		aggregate.initialize(back.data());
+	}
+
+	~StreamingSlidingAggregate() {
+		for (idx_t row = first; row < next; ++row) {
+			Destroy(RowState(row));
+		}
+		Destroy(back.data());
+	}
+
+	//! Adds the next row, and writes the aggregate of the frame that ends at it to result[result_idx]
+	void Next(DataChunk &row, Vector &result, idx_t result_idx) {
+		AggregateInputData aggr_input_data(bind_data, allocator);
+		//	Evict the oldest row
+		if (next - first == frame_size) {
+			if (first == split) {
+				//	The front stack is empty, so the back stack becomes the front stack
+				for (idx_t r = next - 1; r > split; --r) {
+					Combine(RowState(r), RowState(r - 1));
+				}
+				split = next;
+				Destroy(back.data());
+				aggregate.initialize(back.data());
+			}
+			Destroy(RowState(first++));
+		}
+
+		//	Push the new row on the back stack
+		target_ptr = RowState(next++);
+		aggregate.initialize(target_ptr);
+		aggregate.update(row.data.data(), aggr_input_data, row.ColumnCount(), targetv, 1);
+		Combine(target_ptr, back.data());
+
+		//	The frame is the oldest row of the front stack, followed by the back stack
+		aggregate.initialize(frame.data());
+		if (first < split) {
+			Combine(RowState(first), frame.data());
+		}
+		Combine(back.data(), frame.data());
+		target_ptr = frame.data();
+		aggregate.finalize(targetv, aggr_input_data, result, 1, result_idx);
+		Destroy(frame.data());
+	}
+
+private:
+	data_ptr_t RowState(idx_t row) {
+		return states.data() + (row % frame_size) * state_size;
+	}
+
+	void Combine(data_ptr_t source, data_ptr_t target) {
+		AggregateInputData aggr_input_data(bind_data, allocator);
+		source_ptr = source;
+		target_ptr = target;
+		aggregate.combine(sourcev, targetv, aggr_input_data, 1);
+	}
+
+	void Destroy(data_ptr_t state) {
+		if (aggregate.destructor) {
+			AggregateInputData aggr_input_data(bind_data, allocator);
+			target_ptr = state;
+			aggregate.destructor(targetv, aggr_input_data, 1);
+		}
+	}
+
+	AggregateFunction &aggregate;
+	FunctionData *bind_data;
+	ArenaAllocator &allocator;
+	//! The number of rows in the frame
+	const idx_t frame_size;
+	const idx_t state_size;
+	//! The states of the rows in the frame, a ring buffer
+	vector<data_t> states;
+	//! The aggregate of the back stack
+	vector<data_t> back;
+	//! The aggregate of the frame
+	vector<data_t> frame;
+	//! The first row of the frame, the first row of the back stack, and the next row
+	idx_t first;
+	idx_t split;
+	idx_t next;
+	//! Pointers to the states to combine
+	data_ptr_t source_ptr;
+	data_ptr_t target_ptr;
+	Vector sourcev;
+	Vector targetv;
+};
+
 class StreamingWindowState : public OperatorState {
 public:
 	using StateBuffer = vector<data_t>;
@@ -68,6 +189,8 @@ public:
 
 	void Initialize(ClientContext &context, DataChunk &input, const vector<unique_ptr<Expression>> &expressions) {
 		const_vectors.resize(expressions.size());
+		sliding_aggregates.resize(expressions.size());
+		frame_sizes.resize(expressions.size(), DConstants::INVALID_INDEX);
 		aggregate_states.resize(expressions.size());
 		aggregate_bind_data.resize(expressions.size(), nullptr);
 		aggregate_dtors.resize(expressions.size(), nullptr);
@@ -78,6 +201,16 @@ public:
 			switch (expr.GetExpressionType()) {
 			case ExpressionType::WINDOW_AGGREGATE: {
 				auto &aggregate = *wexpr.aggregate;
+				if (wexpr.start != WindowBoundary::UNBOUNDED_PRECEDING) {
+					auto &frame_size = frame_sizes[expr_idx];
+					frame_size = PhysicalStreamingWindow::GetSlidingFrameSize(context, wexpr);
+					D_ASSERT(frame_size != DConstants::INVALID_INDEX);
+					if (!wexpr.children.empty()) {
+						sliding_aggregates[expr_idx] = make_uniq<StreamingSlidingAggregate>(
+						    aggregate, wexpr.bind_info.get(), allocator, frame_size);
+					}
+					break;
+				}
 				auto &state = aggregate_states[expr_idx];
 				aggregate_bind_data[expr_idx] = wexpr.bind_info.get();
 				aggregate_dtors[expr_idx] = aggregate.destructor;
@@ -118,6 +251,8 @@ public:
 	ArenaAllocator allocator;
 
 	// Aggregation
+	vector<unique_ptr<StreamingSlidingAggregate>> sliding_aggregates;
+	vector<idx_t> frame_sizes;
 	vector<StateBuffer> aggregate_states;
 	vector<FunctionData *> aggregate_bind_data;
 	vector<aggregate_destructor_t> aggregate_dtors;
@@ -168,6 +303,13 @@ OperatorResultType PhysicalStreamingWindow::Execute(ExecutionContext &context, D
 				for (idx_t i = 0; i < input.size(); ++i) {
 					data[i] = NumericCast<int64_t>(start_row + NumericCast<int64_t>(i));
 				}
+				// A sliding frame holds at most frame_size rows
+				const auto frame_size = state.frame_sizes[expr_idx];
+				if (frame_size != DConstants::INVALID_INDEX) {
+					for (idx_t i = 0; i < input.size(); ++i) {
+						data[i] = MinValue(data[i], NumericCast<int64_t>(frame_size));
+					}
+				}
 				break;
 			}
 
@@ -202,6 +344,19 @@ OperatorResultType PhysicalStreamingWindow::Execute(ExecutionContext &context, D
 				}
 			}
 
+			// Slide the frame one row at a time.
+			auto &sliding_aggregate = state.sliding_aggregates[expr_idx];
+			if (sliding_aggregate) {
+				for (idx_t i = 0; i < input.size(); ++i) {
+					sel.set_index(0, i);
+					for (const auto struct_idx : structs) {
+						row.data[struct_idx].Slice(payload.data[struct_idx], sel, 1);
+					}
+					sliding_aggregate->Next(row, result, i);
+				}
+				break;
+			}
+
 			// Update the state and finalize it one row at a time.
 			for (idx_t i = 0; i < input.size(); ++i) {
 				sel.set_index(0, i);
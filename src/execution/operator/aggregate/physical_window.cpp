@@ -192,6 +192,8 @@ public:
 
 	//! Get the next task
 	Task NextTask(idx_t hash_bin);
+	//! Assist a partition that is finalizing its executors, returns false if there was nothing to do
+	bool AssistFinalize();
 
 	//! Context for executing computations
 	ClientContext &context;
@@ -203,6 +205,8 @@ public:
 	vector<HashGroupSourcePtr> built;
 	//! Serialise access to the built hash groups
 	mutable mutex built_lock;
+	//! The partitions that are finalizing their executors
+	vector<WindowPartitionSourceState *> finalizing;
 	//! The number of unfinished tasks
 	atomic<idx_t> tasks_remaining;
 	//! The number of rows returned
@@ -261,13 +265,14 @@ public:
 	using OrderMasks = PartitionGlobalHashGroup::OrderMasks;
 
 	WindowPartitionSourceState(ClientContext &context, WindowGlobalSourceState &gsource)
-	    : context(context), op(gsource.gsink.op), gsource(gsource), read_block_idx(0), unscanned(0) {
+	    : context(context), op(gsource.gsink.op), gsource(gsource), read_block_idx(0), unscanned(0), assistants(0) {
 		layout.Initialize(gsource.gsink.global_partition->payload_types);
 	}
 
 	unique_ptr<RowDataCollectionScanner> GetScanner() const;
 	void MaterializeSortedData();
 	void BuildPartition(WindowGlobalSinkState &gstate, const idx_t hash_bin);
+	bool AssistFinalize();
 
 	ClientContext &context;
 	const PhysicalWindow &op;
@@ -294,6 +299,42 @@ public:
 	mutable atomic<idx_t> read_block_idx;
 	//! The number of remaining unscanned blocks.
 	atomic<idx_t> unscanned;
+	//! The number of threads that are assisting the finalization
+	atomic<idx_t> assistants;
+};
+
+//! Offers the finalization of a partition to other threads while it is in scope
+//! The partition is withdrawn, and its assistants are waited for, also if the finalization throws
+struct WindowFinalizingGuard {
+	WindowFinalizingGuard(WindowGlobalSourceState &gsource_p, WindowPartitionSourceState &partition_source_p)
+	    : gsource(gsource_p), partition_source(partition_source_p) {
+		lock_guard<mutex> built_guard(gsource.built_lock);
+		gsource.finalizing.emplace_back(&partition_source);
+	}
+	~WindowFinalizingGuard() {
+		{
+			lock_guard<mutex> built_guard(gsource.built_lock);
+			auto &finalizing = gsource.finalizing;
+			finalizing.erase(std::find(finalizing.begin(), finalizing.end(), &partition_source));
+		}
+		while (partition_source.assistants) {
+			TaskScheduler::YieldThread();
+		}
+	}
+
+	WindowGlobalSourceState &gsource;
+	WindowPartitionSourceState &partition_source;
+};
+
+//! Releases a thread that assists the finalization of a partition when it goes out of scope
+struct WindowAssistantGuard {
+	explicit WindowAssistantGuard(atomic<idx_t> &assistants_p) : assistants(assistants_p) {
+	}
+	~WindowAssistantGuard() {
+		--assistants;
+	}
+
+	atomic<idx_t> &assistants;
 };
 
 void WindowPartitionSourceState::MaterializeSortedData() {
@@ -437,9 +478,12 @@ void WindowPartitionSourceState::BuildPartition(WindowGlobalSinkState &gstate, c
 		input_idx += input_chunk.size();
 	}
 
-	//	TODO: Parallelization opportunity
-	for (auto &wexec : executors) {
-		wexec->Finalize();
+	//	Other threads that are waiting for work can assist with the finalization
+	{
+		WindowFinalizingGuard finalizing_guard(gsource, *this);
+		for (auto &wexec : executors) {
+			wexec->Finalize();
+		}
 	}
 
 	// External scanning assumes all blocks are swizzled.
@@ -449,6 +493,15 @@ void WindowPartitionSourceState::BuildPartition(WindowGlobalSinkState &gstate, c
 	unscanned = rows->blocks.size();
 }
 
+bool WindowPartitionSourceState::AssistFinalize() {
+	for (auto &wexec : executors) {
+		if (wexec->AssistFinalize()) {
+			return true;
+		}
+	}
+	return false;
+}
+
 // Per-thread scan state
 class WindowLocalSourceState : public LocalSourceState {
 public:
@@ -531,6 +584,25 @@ WindowGlobalSourceState::Task WindowGlobalSourceState::StealWork() {
 	return Task();
 }
 
+bool WindowGlobalSourceState::AssistFinalize() {
+	for (idx_t i = 0;; ++i) {
+		optional_ptr<WindowPartitionSourceState> partition_source;
+		{
+			lock_guard<mutex> built_guard(built_lock);
+			if (i >= finalizing.size()) {
+				return false;
+			}
+			//	The partition can not be deleted while we are assisting it
+			partition_source = finalizing[i];
+			++partition_source->assistants;
+		}
+		WindowAssistantGuard assistant_guard(partition_source->assistants);
+		if (partition_source->AssistFinalize()) {
+			return true;
+		}
+	}
+}
+
 WindowGlobalSourceState::Task WindowGlobalSourceState::NextTask(idx_t hash_bin) {
 	auto &hash_groups = gsink.global_partition->hash_groups;
 	const auto bin_count = built.size();
@@ -580,8 +652,10 @@ WindowGlobalSourceState::Task WindowGlobalSourceState::NextTask(idx_t hash_bin)
 		}
 
 		//	If there is nothing to steal but there are unfinished partitions,
-		//	yield until any pending builds are done.
-		TaskScheduler::YieldThread();
+		//	assist with the pending builds, or yield until they are done.
+		if (!AssistFinalize()) {
+			TaskScheduler::YieldThread();
+		}
 	}
 
 	return Task();
@@ -21,6 +21,7 @@ SinkFinalizeType PhysicalExplainAnalyze::Finalize(Pipeline &pipeline, Event &eve
                                                   OperatorSinkFinalizeInput &input) const {
 	auto &gstate = input.global_state.Cast<ExplainAnalyzeStateGlobalState>();
 	auto &profiler = QueryProfiler::Get(context);
+	profiler.UpdateRuntimeInfo();
 	gstate.analyzed_plan = profiler.ToString();
 	return SinkFinalizeType::READY;
 }
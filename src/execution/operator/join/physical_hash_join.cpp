@@ -11,9 +11,13 @@
 #include "duckdb/parallel/pipeline.hpp"
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/parallel/executor_task.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/storage/temporary_memory_manager.hpp"
 
@@ -87,8 +91,9 @@ PhysicalHashJoin::PhysicalHashJoin(LogicalOperator &op, unique_ptr<PhysicalOpera
 //===--------------------------------------------------------------------===//
 class HashJoinGlobalSinkState : public GlobalSinkState {
 public:
-	HashJoinGlobalSinkState(const PhysicalHashJoin &op, ClientContext &context_p)
-	    : context(context_p), num_threads(NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads())),
+	HashJoinGlobalSinkState(const PhysicalHashJoin &op_p, ClientContext &context_p)
+	    : op(op_p), context(context_p),
+	      num_threads(NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads())),
 	      temporary_memory_update_count(0),
 	      temporary_memory_state(TemporaryMemoryManager::Get(context).Register(context)), finalized(false),
 	      scanned_data(false) {
@@ -103,12 +108,30 @@ public:
 		probe_types.insert(probe_types.end(), op.condition_types.begin(), op.condition_types.end());
 		probe_types.insert(probe_types.end(), payload_types.begin(), payload_types.end());
 		probe_types.emplace_back(LogicalType::HASH);
+		// Initialize the statistics of the build side keys that we push into the probe side
+		for (auto &pushdown : op.filter_pushdown) {
+			// the filter might still be set from a previous execution of this plan
+			pushdown.filter_data->Reset();
+			auto &type = op.condition_types[pushdown.condition_idx];
+			if (PhysicalHashJoin::CanPushDownRangeFilter(type)) {
+				filter_stats.push_back(BaseStatistics::CreateEmpty(type).ToUnique());
+			} else {
+				filter_stats.push_back(nullptr);
+			}
+		}
 	}
 
 	void ScheduleFinalize(Pipeline &pipeline, Event &event);
 	void InitializeProbeSpill();
+	//! Whether or not the Bloom filter over the build side keys can be used by the probe side scan
+	bool CanPushDownBloomFilter() const;
+	//! Creates the Bloom filter over the build side keys (if it pays off)
+	void InitializeBloomFilter();
+	//! Sets the filters over the build side keys in the probe side table scans
+	void PushDownJoinFilters();
 
 public:
+	const PhysicalHashJoin &op;
 	ClientContext &context;
 
 	const idx_t num_threads;
@@ -136,6 +159,9 @@ public:
 
 	//! Whether or not we have started scanning data using GetData
 	atomic<bool> scanned_data;
+
+	//! The min/max of the build side keys that are pushed into the probe side (one per pushed down condition)
+	vector<unique_ptr<BaseStatistics>> filter_stats;
 };
 
 class HashJoinLocalSinkState : public LocalSinkState {
@@ -155,6 +181,15 @@ public:
 
 		hash_table = op.InitializeHashTable(context);
 		hash_table->GetSinkCollection().InitializeAppendState(append_state);
+
+		for (auto &pushdown : op.filter_pushdown) {
+			auto &type = op.condition_types[pushdown.condition_idx];
+			if (PhysicalHashJoin::CanPushDownRangeFilter(type)) {
+				filter_stats.push_back(BaseStatistics::CreateEmpty(type).ToUnique());
+			} else {
+				filter_stats.push_back(nullptr);
+			}
+		}
 	}
 
 public:
@@ -171,6 +206,9 @@ public:
 	//! For updating the temporary memory state
 	idx_t chunk_count;
 	static constexpr const idx_t CHUNK_COUNT_UPDATE_INTERVAL = 60;
+
+	//! Thread-local min/max of the build side keys that are pushed into the probe side
+	vector<unique_ptr<BaseStatistics>> filter_stats;
 };
 
 unique_ptr<JoinHashTable> PhysicalHashJoin::InitializeHashTable(ClientContext &context) const {
@@ -232,6 +270,82 @@ unique_ptr<LocalSinkState> PhysicalHashJoin::GetLocalSinkState(ExecutionContext
 	return make_uniq<HashJoinLocalSinkState>(*this, context.client);
 }
 
+bool PhysicalHashJoin::CanPushDownJoinFilters() const {
+	switch (join_type) {
+	case JoinType::INNER:
+	case JoinType::SEMI:
+	case JoinType::RIGHT:
+	case JoinType::RIGHT_SEMI:
+		return true;
+	default:
+		return false;
+	}
+}
+
+bool PhysicalHashJoin::CanPushDownRangeFilter(const LogicalType &type) {
+	// no floating point types: NaN is equal to NaN in joins, but is not within the min/max
+	switch (type.id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::HUGEINT:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::UBIGINT:
+	case LogicalTypeId::DECIMAL:
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::TIME:
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_SEC:
+	case LogicalTypeId::TIMESTAMP_MS:
+	case LogicalTypeId::TIMESTAMP_NS:
+	case LogicalTypeId::TIMESTAMP_TZ:
+		return true;
+	default:
+		return false;
+	}
+}
+
+template <class T>
+static void TemplatedUpdateFilterStatistics(BaseStatistics &stats, Vector &keys, idx_t count) {
+	UnifiedVectorFormat kdata;
+	keys.ToUnifiedFormat(count, kdata);
+	const auto key_data = UnifiedVectorFormat::GetData<T>(kdata);
+	for (idx_t i = 0; i < count; i++) {
+		const auto idx = kdata.sel->get_index(i);
+		if (kdata.validity.RowIsValid(idx)) {
+			NumericStats::Update<T>(stats, key_data[idx]);
+		}
+	}
+}
+
+static void UpdateFilterStatistics(BaseStatistics &stats, Vector &keys, idx_t count) {
+	switch (keys.GetType().InternalType()) {
+	case PhysicalType::INT8:
+		return TemplatedUpdateFilterStatistics<int8_t>(stats, keys, count);
+	case PhysicalType::INT16:
+		return TemplatedUpdateFilterStatistics<int16_t>(stats, keys, count);
+	case PhysicalType::INT32:
+		return TemplatedUpdateFilterStatistics<int32_t>(stats, keys, count);
+	case PhysicalType::INT64:
+		return TemplatedUpdateFilterStatistics<int64_t>(stats, keys, count);
+	case PhysicalType::INT128:
+		return TemplatedUpdateFilterStatistics<hugeint_t>(stats, keys, count);
+	case PhysicalType::UINT8:
+		return TemplatedUpdateFilterStatistics<uint8_t>(stats, keys, count);
+	case PhysicalType::UINT16:
+		return TemplatedUpdateFilterStatistics<uint16_t>(stats, keys, count);
+	case PhysicalType::UINT32:
+		return TemplatedUpdateFilterStatistics<uint32_t>(stats, keys, count);
+	case PhysicalType::UINT64:
+		return TemplatedUpdateFilterStatistics<uint64_t>(stats, keys, count);
+	default:
+		throw InternalException("Unsupported type for join filter pushdown");
+	}
+}
+
 SinkResultType PhysicalHashJoin::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const {
 	auto &lstate = input.local_state.Cast<HashJoinLocalSinkState>();
 
@@ -239,6 +353,14 @@ SinkResultType PhysicalHashJoin::Sink(ExecutionContext &context, DataChunk &chun
 	lstate.join_keys.Reset();
 	lstate.join_key_executor.Execute(chunk, lstate.join_keys);
 
+	// keep track of the min/max of the keys that we push into the probe side
+	for (idx_t i = 0; i < filter_pushdown.size(); i++) {
+		if (lstate.filter_stats[i]) {
+			auto &keys = lstate.join_keys.data[filter_pushdown[i].condition_idx];
+			UpdateFilterStatistics(*lstate.filter_stats[i], keys, lstate.join_keys.size());
+		}
+	}
+
 	// build the HT
 	auto &ht = *lstate.hash_table;
 	if (payload_types.empty()) {
@@ -274,6 +396,11 @@ SinkCombineResultType PhysicalHashJoin::Combine(ExecutionContext &context, Opera
 		lstate.hash_table->GetSinkCollection().FlushAppendState(lstate.append_state);
 		lock_guard<mutex> local_ht_lock(gstate.lock);
 		gstate.local_hash_tables.push_back(std::move(lstate.hash_table));
+		for (idx_t i = 0; i < gstate.filter_stats.size(); i++) {
+			if (gstate.filter_stats[i]) {
+				gstate.filter_stats[i]->Merge(*lstate.filter_stats[i]);
+			}
+		}
 	}
 	auto &client_profiler = QueryProfiler::Get(context.client);
 	context.thread.profiler.Flush(*this, lstate.join_key_executor, "join_key_executor", 1);
@@ -348,6 +475,10 @@ public:
 	void FinishEvent() override {
 		sink.hash_table->GetDataCollection().VerifyEverythingPinned();
 		sink.hash_table->finalized = true;
+		if (sink.hash_table->bloom_filter) {
+			// the Bloom filter has been filled, we can now push the filters into the probe side
+			sink.PushDownJoinFilters();
+		}
 	}
 
 	static constexpr const idx_t PARALLEL_CONSTRUCT_THRESHOLD = 1048576;
@@ -363,6 +494,52 @@ void HashJoinGlobalSinkState::ScheduleFinalize(Pipeline &pipeline, Event &event)
 	event.InsertEvent(std::move(new_event));
 }
 
+bool HashJoinGlobalSinkState::CanPushDownBloomFilter() const {
+	// the hashes of multiple conditions are combined, so the probe side scan cannot compute them
+	return !op.filter_pushdown.empty() && op.conditions.size() == 1 && !op.condition_types[0].IsNested();
+}
+
+void HashJoinGlobalSinkState::InitializeBloomFilter() {
+	// the Bloom filter only pays off if it is small
+	const auto count = hash_table->Count();
+	if (count > PhysicalHashJoin::JOIN_FILTER_BLOOM_THRESHOLD) {
+		return;
+	}
+	// pushing it into the probe side only pays off if there are more rows on the probe side than keys
+	const auto push_down = CanPushDownBloomFilter() && count < op.children[0]->estimated_cardinality;
+	if (!push_down && !op.bloom_filter_probe) {
+		return;
+	}
+	hash_table->bloom_filter = make_shared_ptr<BloomFilter>(count);
+	hash_table->bloom_filter_probe = op.bloom_filter_probe;
+}
+
+void HashJoinGlobalSinkState::PushDownJoinFilters() {
+	for (idx_t i = 0; i < op.filter_pushdown.size(); i++) {
+		auto &pushdown = op.filter_pushdown[i];
+		unique_ptr<TableFilter> range_filter;
+		if (filter_stats[i]) {
+			// range filter on the min/max of the build side keys
+			// if there were no (non-NULL) keys, min > max, and the filter prunes everything
+			auto min = NumericStats::Min(*filter_stats[i]);
+			auto max = NumericStats::Max(*filter_stats[i]);
+			if (min == max) {
+				range_filter = make_uniq<ConstantFilter>(ExpressionType::COMPARE_EQUAL, std::move(min));
+			} else {
+				auto and_filter = make_uniq<ConjunctionAndFilter>();
+				and_filter->child_filters.push_back(
+				    make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO, std::move(min)));
+				and_filter->child_filters.push_back(
+				    make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHANOREQUALTO, std::move(max)));
+				range_filter = std::move(and_filter);
+			}
+		}
+		auto bloom_filter = CanPushDownBloomFilter() ? hash_table->bloom_filter : nullptr;
+		pushdown.filter_data->SetFilter(std::move(range_filter), std::move(bloom_filter),
+		                                op.condition_types[pushdown.condition_idx]);
+	}
+}
+
 void HashJoinGlobalSinkState::InitializeProbeSpill() {
 	lock_guard<mutex> guard(lock);
 	if (!probe_spill) {
@@ -470,6 +647,7 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 		const auto max_partition_ht_size = max_partition_size + JoinHashTable::PointerTableSize(max_partition_count);
 		// External Hash Join
 		sink.perfect_join_executor.reset();
+		sink.PushDownJoinFilters();
 		if (max_partition_ht_size > sink.temporary_memory_state->GetReservation()) {
 			// We have to repartition
 			ht.SetRepartitionRadixBits(sink.local_hash_tables, sink.temporary_memory_state->GetReservation(),
@@ -507,8 +685,15 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 	// In case of a large build side or duplicates, use regular hash join
 	if (!use_perfect_hash) {
 		sink.perfect_join_executor.reset();
+		if (ht.Count() != 0) {
+			sink.InitializeBloomFilter();
+		}
 		sink.ScheduleFinalize(pipeline, event);
 	}
+	if (!ht.bloom_filter) {
+		// no need to wait for the Bloom filter: push the filters into the probe side right away
+		sink.PushDownJoinFilters();
+	}
 	sink.finalized = true;
 	if (ht.Count() == 0 && EmptyResultIfRHSIsEmpty()) {
 		return SinkFinalizeType::NO_OUTPUT_POSSIBLE;
@@ -1097,6 +1282,17 @@ string PhysicalHashJoin::ParamsToString() const {
 		result += "Build Max: " + perfect_join_statistics.build_max.ToString() + "\n";
 		result += "\n[INFOSEPARATOR]\n";
 	}
+	if (sink_state && sink_state->Cast<HashJoinGlobalSinkState>().hash_table) {
+		// the pass rate of the Bloom filter that was checked before probing (if any)
+		auto &ht = *sink_state->Cast<HashJoinGlobalSinkState>().hash_table;
+		const idx_t probe_count = ht.bloom_filter_probe_count;
+		if (probe_count != 0) {
+			const idx_t pass_count = ht.bloom_filter_pass_count;
+			const auto pass_rate = 100.0 * double(pass_count) / double(probe_count);
+			result += StringUtil::Format("Bloom Filter Pass Rate: %.2f%%\n", pass_rate);
+			result += "\n[INFOSEPARATOR]\n";
+		}
+	}
 	result += StringUtil::Format("EC: %llu\n", estimated_cardinality);
 	return result;
 }
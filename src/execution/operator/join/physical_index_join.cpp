@@ -0,0 +1,298 @@
+#include "duckdb/execution/operator/join/physical_index_join.hpp"
+
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/execution/index/art/art.hpp"
+#include "duckdb/execution/index/art/art_key.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table/append_state.hpp"
+#include "duckdb/storage/table/column_segment.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+#include "duckdb/storage/table_io_manager.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
+#include "duckdb/transaction/local_storage.hpp"
+
+namespace duckdb {
+
+PhysicalIndexJoin::PhysicalIndexJoin(vector<LogicalType> types, unique_ptr<PhysicalOperator> outer,
+                                     unique_ptr<Expression> outer_key, vector<idx_t> outer_projection_map_p,
+                                     DuckTableEntry &table, ART &index, vector<column_t> fetch_ids_p,
+                                     vector<LogicalType> fetch_types_p, unique_ptr<TableFilterSet> table_filters_p,
+                                     unique_ptr<Expression> filter_expression_p, bool inner_is_left,
+                                     idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::INDEX_JOIN, std::move(types), estimated_cardinality),
+      outer_key(std::move(outer_key)), outer_projection_map(std::move(outer_projection_map_p)), table(table),
+      index(index), fetch_ids(std::move(fetch_ids_p)), fetch_types(std::move(fetch_types_p)),
+      table_filters(std::move(table_filters_p)), filter_expression(std::move(filter_expression_p)),
+      inner_is_left(inner_is_left) {
+	children.push_back(std::move(outer));
+	if (outer_projection_map.empty()) {
+		for (idx_t i = 0; i < children[0]->types.size(); i++) {
+			outer_projection_map.push_back(i);
+		}
+	}
+	inner_column_count = this->types.size() - outer_projection_map.size();
+	D_ASSERT(inner_column_count <= fetch_ids.size());
+	// the row ids are fetched along with the emitted columns, to match the fetched rows to the outer rows
+	fetch_ids.push_back(COLUMN_IDENTIFIER_ROW_ID);
+	fetch_types.push_back(LogicalType::ROW_TYPE);
+}
+
+//===--------------------------------------------------------------------===//
+// State
+//===--------------------------------------------------------------------===//
+class IndexJoinGlobalState : public GlobalOperatorState {
+public:
+	//! Creates an index over the rows that were appended to the table by this transaction, as these are not in the
+	//! index of the table yet
+	void InitializeLocalIndex(ClientContext &context, const PhysicalIndexJoin &op);
+
+	mutex lock;
+	bool initialized = false;
+	//! The index over the transaction-local rows (if any)
+	unique_ptr<ART> local_index;
+};
+
+void IndexJoinGlobalState::InitializeLocalIndex(ClientContext &context, const PhysicalIndexJoin &op) {
+	lock_guard<mutex> guard(lock);
+	if (initialized) {
+		return;
+	}
+	initialized = true;
+
+	auto &storage = op.table.GetStorage();
+	auto &local_storage = LocalStorage::Get(context, op.table.catalog);
+	if (local_storage.AddedRows(storage) == 0) {
+		return;
+	}
+	auto &index = op.index;
+	local_index = make_uniq<ART>(index.GetIndexName(), IndexConstraintType::NONE, index.GetColumnIds(),
+	                             TableIOManager::Get(storage), index.unbound_expressions, storage.db);
+
+	// scan the join column and the row ids of the transaction-local rows
+	auto key_column = op.table.GetColumn(LogicalIndex(index.GetColumnIds()[0])).StorageOid();
+	vector<storage_t> column_ids {key_column, COLUMN_IDENTIFIER_ROW_ID};
+	TableScanState scan_state;
+	scan_state.Initialize(column_ids);
+	local_storage.InitializeScan(storage, scan_state.local_state, nullptr);
+
+	DataChunk scan_chunk;
+	scan_chunk.Initialize(context, {index.logical_types[0], LogicalType::ROW_TYPE});
+	DataChunk key_chunk;
+	key_chunk.InitializeEmpty({index.logical_types[0]});
+	IndexLock index_lock;
+	local_index->InitializeLock(index_lock);
+	while (true) {
+		scan_chunk.Reset();
+		local_storage.Scan(scan_state.local_state, column_ids, scan_chunk);
+		if (scan_chunk.size() == 0) {
+			break;
+		}
+		key_chunk.data[0].Reference(scan_chunk.data[0]);
+		key_chunk.SetCardinality(scan_chunk);
+		local_index->Insert(index_lock, key_chunk, scan_chunk.data[1]);
+	}
+}
+
+//! The row ids that match the keys of the current input chunk, in a single storage (committed or transaction-local)
+struct IndexJoinMatches {
+	//! The row ids of the matching rows
+	vector<row_t> row_ids;
+	//! For every row id, the index of its row in the input chunk
+	vector<idx_t> input_indexes;
+	//! The position of the next row id to fetch
+	idx_t position = 0;
+
+	void Reset() {
+		row_ids.clear();
+		input_indexes.clear();
+		position = 0;
+	}
+	bool Finished() const {
+		return position >= row_ids.size();
+	}
+};
+
+class IndexJoinOperatorState : public OperatorState {
+public:
+	IndexJoinOperatorState(ClientContext &context, const PhysicalIndexJoin &op)
+	    : executor(context, *op.outer_key), arena_allocator(BufferAllocator::Get(context)),
+	      keys(STANDARD_VECTOR_SIZE), input_sel(STANDARD_VECTOR_SIZE), filter_executor(context),
+	      filter_sel(STANDARD_VECTOR_SIZE) {
+		key_chunk.Initialize(context, {op.outer_key->return_type});
+		fetch_chunk.Initialize(context, op.fetch_types);
+		if (op.filter_expression) {
+			filter_executor.AddExpression(*op.filter_expression);
+		}
+	}
+
+	ExpressionExecutor executor;
+	DataChunk key_chunk;
+	ArenaAllocator arena_allocator;
+	vector<ARTKey> keys;
+	//! Whether the keys of the current input chunk have been looked up
+	bool lookup_done = false;
+	//! The matching committed rows and the matching transaction-local rows
+	IndexJoinMatches committed;
+	IndexJoinMatches local;
+
+	ColumnFetchState fetch_state;
+	DataChunk fetch_chunk;
+	SelectionVector input_sel;
+
+	//! Evaluates the filter expression on the fetched rows
+	ExpressionExecutor filter_executor;
+	SelectionVector filter_sel;
+};
+
+unique_ptr<OperatorState> PhysicalIndexJoin::GetOperatorState(ExecutionContext &context) const {
+	return make_uniq<IndexJoinOperatorState>(context.client, *this);
+}
+
+unique_ptr<GlobalOperatorState> PhysicalIndexJoin::GetGlobalOperatorState(ClientContext &context) const {
+	return make_uniq<IndexJoinGlobalState>();
+}
+
+//===--------------------------------------------------------------------===//
+// Execute
+//===--------------------------------------------------------------------===//
+//! Keeps only the selected fetched rows, in the fetch chunk and in "input_sel"
+static void SelectMatches(IndexJoinOperatorState &state, const SelectionVector &sel, idx_t count) {
+	SelectionVector input_sel(count);
+	for (idx_t i = 0; i < count; i++) {
+		input_sel.set_index(i, state.input_sel.get_index(sel.get_index(i)));
+	}
+	for (idx_t i = 0; i < count; i++) {
+		state.input_sel.set_index(i, input_sel.get_index(i));
+	}
+	state.fetch_chunk.Slice(sel, count);
+}
+
+//! Applies the filters of the replaced table scan and the filter on top of it to the fetched rows, and removes the
+//! rows that do not pass. Returns the number of remaining rows
+static idx_t FilterMatches(const PhysicalIndexJoin &op, IndexJoinOperatorState &state) {
+	auto count = state.fetch_chunk.size();
+	if (op.table_filters) {
+		SelectionVector sel;
+		idx_t approved_count = count;
+		for (auto &entry : op.table_filters->filters) {
+			auto &vector = state.fetch_chunk.data[entry.first];
+			UnifiedVectorFormat vdata;
+			vector.ToUnifiedFormat(count, vdata);
+			ColumnSegment::FilterSelection(sel, vector, vdata, *entry.second, count, approved_count);
+			if (approved_count == 0) {
+				break;
+			}
+		}
+		if (approved_count < count) {
+			SelectMatches(state, sel, approved_count);
+			count = approved_count;
+		}
+	}
+	if (op.filter_expression && count > 0) {
+		auto approved_count = state.filter_executor.SelectExpression(state.fetch_chunk, state.filter_sel);
+		if (approved_count < count) {
+			SelectMatches(state, state.filter_sel, approved_count);
+			count = approved_count;
+		}
+	}
+	return count;
+}
+
+//! Fetches the next batch of matching rows into the fetch chunk, and sets "input_sel" to their rows in the input.
+//! Returns the number of fetched rows
+static idx_t FetchMatches(ExecutionContext &context, const PhysicalIndexJoin &op, IndexJoinOperatorState &state,
+                          IndexJoinMatches &matches, bool is_local) {
+	auto &storage = op.table.GetStorage();
+	auto &transaction = DuckTransaction::Get(context.client, op.table.catalog);
+
+	auto start = matches.position;
+	auto count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, matches.row_ids.size() - start);
+	matches.position += count;
+
+	Vector row_ids(LogicalType::ROW_TYPE, data_ptr_cast(matches.row_ids.data() + start));
+	state.fetch_chunk.Reset();
+	if (is_local) {
+		auto &local_storage = LocalStorage::Get(transaction);
+		local_storage.FetchChunk(storage, row_ids, count, op.fetch_ids, state.fetch_chunk, state.fetch_state);
+	} else {
+		storage.Fetch(transaction, state.fetch_chunk, op.fetch_ids, row_ids, count, state.fetch_state);
+	}
+
+	// the index can contain rows that are not visible to this transaction, which are skipped by the fetch
+	// the fetched rows are in the order of the row ids, so we can match them to the row ids one by one
+	auto fetched_ids = FlatVector::GetData<row_t>(state.fetch_chunk.data.back());
+	auto match_idx = start;
+	for (idx_t i = 0; i < state.fetch_chunk.size(); i++) {
+		while (matches.row_ids[match_idx] != fetched_ids[i]) {
+			match_idx++;
+			D_ASSERT(match_idx < start + count);
+		}
+		state.input_sel.set_index(i, matches.input_indexes[match_idx++]);
+	}
+	if ((op.table_filters || op.filter_expression) && state.fetch_chunk.size() > 0) {
+		return FilterMatches(op, state);
+	}
+	return state.fetch_chunk.size();
+}
+
+OperatorResultType PhysicalIndexJoin::Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+                                              GlobalOperatorState &gstate_p, OperatorState &state_p) const {
+	auto &gstate = gstate_p.Cast<IndexJoinGlobalState>();
+	auto &state = state_p.Cast<IndexJoinOperatorState>();
+
+	if (!state.lookup_done) {
+		gstate.InitializeLocalIndex(context.client, *this);
+		// look up the join keys of the input chunk in the index
+		state.key_chunk.Reset();
+		state.executor.Execute(input, state.key_chunk);
+		state.arena_allocator.Reset();
+		ART::GenerateKeys(state.arena_allocator, state.key_chunk, state.keys);
+		state.committed.Reset();
+		state.local.Reset();
+		index.SearchEqualJoin(state.keys, input.size(), state.committed.row_ids, state.committed.input_indexes);
+		if (gstate.local_index) {
+			gstate.local_index->SearchEqualJoin(state.keys, input.size(), state.local.row_ids,
+			                                    state.local.input_indexes);
+		}
+		state.lookup_done = true;
+	}
+
+	// emit the matches in batches of at most STANDARD_VECTOR_SIZE rows
+	idx_t result_count = 0;
+	while (result_count == 0) {
+		if (!state.committed.Finished()) {
+			result_count = FetchMatches(context, *this, state, state.committed, false);
+		} else if (!state.local.Finished()) {
+			result_count = FetchMatches(context, *this, state, state.local, true);
+		} else {
+			break;
+		}
+	}
+
+	if (result_count > 0) {
+		const auto inner_offset = inner_is_left ? 0 : outer_projection_map.size();
+		const auto outer_offset = inner_is_left ? inner_column_count : 0;
+		for (idx_t i = 0; i < inner_column_count; i++) {
+			chunk.data[inner_offset + i].Reference(state.fetch_chunk.data[i]);
+		}
+		for (idx_t i = 0; i < outer_projection_map.size(); i++) {
+			chunk.data[outer_offset + i].Slice(input.data[outer_projection_map[i]], state.input_sel, result_count);
+		}
+		chunk.SetCardinality(result_count);
+	}
+
+	if (state.committed.Finished() && state.local.Finished()) {
+		// all matches of this input chunk have been emitted
+		state.lookup_done = false;
+		return OperatorResultType::NEED_MORE_INPUT;
+	}
+	return OperatorResultType::HAVE_MORE_OUTPUT;
+}
+
+string PhysicalIndexJoin::ParamsToString() const {
+	return table.name + "\n[INFOSEPARATOR]\n" + index.GetIndexName();
+}
+
+} // namespace duckdb
@@ -6,6 +6,8 @@
 #include "duckdb/common/value_operations/value_operations.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/storage/data_table.hpp"
 
 namespace duckdb {
@@ -84,7 +86,8 @@ public:
 public:
 	void Sink(DataChunk &input);
 	void Combine(TopNHeap &other);
-	void Reduce();
+	//! Reduces the heap to the top-n if it has grown large enough. Returns true if the boundary values were updated
+	bool Reduce();
 	void Finalize();
 
 	void ExtractBoundaryValues(DataChunk &current_chunk, DataChunk &prev_chunk);
@@ -275,11 +278,11 @@ void TopNHeap::Finalize() {
 	sort_state.Finalize();
 }
 
-void TopNHeap::Reduce() {
+bool TopNHeap::Reduce() {
 	idx_t min_sort_threshold = MaxValue<idx_t>(STANDARD_VECTOR_SIZE * 5ULL, 2ULL * (limit + offset));
 	if (sort_state.count < min_sort_threshold) {
 		// only reduce when we pass two times the limit + offset, or 5 vectors (whichever comes first)
-		return;
+		return false;
 	}
 	sort_state.Finalize();
 	TopNSortState new_state(*this);
@@ -306,6 +309,7 @@ void TopNHeap::Reduce() {
 	}
 
 	sort_state.Move(new_state);
+	return has_boundary_values;
 }
 
 void TopNHeap::ExtractBoundaryValues(DataChunk &current_chunk, DataChunk &prev_chunk) {
@@ -407,8 +411,35 @@ public:
 
 	mutex lock;
 	TopNHeap heap;
+	//! The boundary that is currently set in the dynamic filter (if any)
+	Value filter_boundary;
+
+public:
+	//! Tightens the dynamic filter in the table scan to the boundary of "source" (if it is tighter than the current)
+	void UpdateDynamicFilter(const PhysicalTopN &op, const TopNHeap &source);
 };
 
+void TopNGlobalState::UpdateDynamicFilter(const PhysicalTopN &op, const TopNHeap &source) {
+	D_ASSERT(op.dynamic_filter && source.has_boundary_values);
+	// every heap holds limit + offset rows that are at least as good as its boundary, so rows that are worse than the
+	// boundary on the first order column cannot make it into the result
+	auto boundary = source.boundary_values.GetValue(0, 0);
+	if (boundary.IsNull()) {
+		return;
+	}
+	auto &order = op.orders[0];
+	D_ASSERT(order.null_order == OrderByNullType::NULLS_LAST);
+	const bool ascending = order.type == OrderType::ASCENDING;
+	if (!filter_boundary.IsNull() && (ascending ? boundary >= filter_boundary : boundary <= filter_boundary)) {
+		// the current filter is at least as tight
+		return;
+	}
+	filter_boundary = boundary;
+	auto comparison =
+	    ascending ? ExpressionType::COMPARE_LESSTHANOREQUALTO : ExpressionType::COMPARE_GREATERTHANOREQUALTO;
+	op.dynamic_filter->UpdateFilter(make_uniq<ConstantFilter>(comparison, std::move(boundary)));
+}
+
 class TopNLocalState : public LocalSinkState {
 public:
 	TopNLocalState(ExecutionContext &context, const vector<LogicalType> &payload_types,
@@ -424,6 +455,10 @@ unique_ptr<LocalSinkState> PhysicalTopN::GetLocalSinkState(ExecutionContext &con
 }
 
 unique_ptr<GlobalSinkState> PhysicalTopN::GetGlobalSinkState(ClientContext &context) const {
+	if (dynamic_filter) {
+		// the filter might still be set from a previous execution of this plan
+		dynamic_filter->Reset();
+	}
 	return make_uniq<TopNGlobalState>(context, types, orders, limit, offset);
 }
 
@@ -434,7 +469,11 @@ SinkResultType PhysicalTopN::Sink(ExecutionContext &context, DataChunk &chunk, O
 	// append to the local sink state
 	auto &sink = input.local_state.Cast<TopNLocalState>();
 	sink.heap.Sink(chunk);
-	sink.heap.Reduce();
+	if (sink.heap.Reduce() && dynamic_filter) {
+		auto &gstate = input.global_state.Cast<TopNGlobalState>();
+		lock_guard<mutex> glock(gstate.lock);
+		gstate.UpdateDynamicFilter(*this, sink.heap);
+	}
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
@@ -448,6 +487,9 @@ SinkCombineResultType PhysicalTopN::Combine(ExecutionContext &context, OperatorS
 	// scan the local top N and append it to the global heap
 	lock_guard<mutex> glock(gstate.lock);
 	gstate.heap.Combine(lstate.heap);
+	if (dynamic_filter && gstate.heap.has_boundary_values) {
+		gstate.UpdateDynamicFilter(*this, gstate.heap);
+	}
 
 	return SinkCombineResultType::FINISHED;
 }
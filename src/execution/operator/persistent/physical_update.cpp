@@ -9,7 +9,9 @@
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/storage/table/delete_state.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
 #include "duckdb/storage/table/update_state.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
 
 namespace duckdb {
 
@@ -30,13 +32,17 @@ PhysicalUpdate::PhysicalUpdate(vector<LogicalType> types, TableCatalogEntry &tab
 class UpdateGlobalState : public GlobalSinkState {
 public:
 	explicit UpdateGlobalState(ClientContext &context, const vector<LogicalType> &return_types)
-	    : updated_count(0), return_collection(context, return_types) {
+	    : updated_count(0), return_collection(context, return_types), bulk_update_threshold(0), is_bulk_update(false) {
 	}
 
 	mutex lock;
 	idx_t updated_count;
 	unordered_set<row_t> updated_columns;
 	ColumnDataCollection return_collection;
+	//! The number of updated rows after which the update switches to a delete and an insert (0 = never)
+	idx_t bulk_update_threshold;
+	//! Whether the threshold has been reached
+	bool is_bulk_update;
 };
 
 class UpdateLocalState : public LocalSinkState {
@@ -64,6 +70,40 @@ public:
 	unique_ptr<TableUpdateState> update_state;
 	const vector<unique_ptr<BoundConstraint>> &bound_constraints;
 
+	//! Used to fetch the columns that are not updated for a bulk update
+	vector<column_t> fetch_ids;
+	DataChunk fetch_chunk;
+	ColumnFetchState fetch_state;
+	SelectionVector committed_sel;
+	SelectionVector local_sel;
+	SelectionVector fetch_sel;
+	unordered_set<row_t> chunk_row_ids;
+
+	void InitializeBulkUpdate(ClientContext &context, const PhysicalUpdate &op) {
+		if (!fetch_ids.empty()) {
+			return;
+		}
+		auto table_types = op.table.GetTypes();
+		vector<bool> is_updated(table_types.size(), false);
+		for (auto &column : op.columns) {
+			is_updated[column.index] = true;
+		}
+		vector<LogicalType> fetch_types;
+		for (idx_t i = 0; i < table_types.size(); i++) {
+			if (!is_updated[i]) {
+				fetch_ids.push_back(i);
+				fetch_types.push_back(table_types[i]);
+			}
+		}
+		// the row ids are fetched as well, to match the fetched rows to the updated rows
+		fetch_ids.push_back(COLUMN_IDENTIFIER_ROW_ID);
+		fetch_types.push_back(LogicalType::ROW_TYPE);
+		fetch_chunk.Initialize(Allocator::Get(context), fetch_types);
+		committed_sel.Initialize(STANDARD_VECTOR_SIZE);
+		local_sel.Initialize(STANDARD_VECTOR_SIZE);
+		fetch_sel.Initialize(STANDARD_VECTOR_SIZE);
+	}
+
 	TableDeleteState &GetDeleteState(DataTable &table, TableCatalogEntry &tableref, ClientContext &context) {
 		if (!delete_state) {
 			delete_state = table.InitializeDelete(tableref, context, bound_constraints);
@@ -79,6 +119,80 @@ public:
 	}
 };
 
+//! Replaces the updated rows with new rows that are appended to the table, instead of storing in-place updates
+//! that have to be merged into every scan. The columns that are not updated are fetched from the table.
+void PhysicalUpdate::BulkUpdate(ExecutionContext &context, UpdateGlobalState &gstate, UpdateLocalState &lstate,
+                                Vector &row_ids) const {
+	auto &update_chunk = lstate.update_chunk;
+	auto &mock_chunk = lstate.mock_chunk;
+	auto &fetch_chunk = lstate.fetch_chunk;
+	lstate.InitializeBulkUpdate(context.client, *this);
+
+	// rows that were appended by this transaction are updated in-place in the local storage
+	// a row can occur multiple times (e.g. because of joins): only its first occurrence is used
+	auto row_id_data = FlatVector::GetData<row_t>(row_ids);
+	idx_t committed_count = 0;
+	idx_t local_count = 0;
+	lstate.chunk_row_ids.clear();
+	for (idx_t i = 0; i < update_chunk.size(); i++) {
+		auto row_id = row_id_data[i];
+		if (row_id >= MAX_ROW_ID) {
+			lstate.local_sel.set_index(local_count++, i);
+		} else if (lstate.chunk_row_ids.insert(row_id).second) {
+			lstate.committed_sel.set_index(committed_count++, i);
+		}
+	}
+	if (local_count > 0) {
+		DataChunk local_chunk;
+		local_chunk.InitializeEmpty(update_chunk.GetTypes());
+		local_chunk.Slice(update_chunk, lstate.local_sel, local_count);
+		Vector local_ids(row_ids, lstate.local_sel, local_count);
+		local_ids.Flatten(local_count);
+		auto &update_state = lstate.GetUpdateState(table, tableref, context.client);
+		table.Update(update_state, context.client, local_ids, columns, local_chunk);
+	}
+	if (committed_count == 0) {
+		return;
+	}
+
+	// fetch the columns that are not updated
+	// rows that were already replaced by this update are no longer visible, and are skipped by the fetch
+	Vector committed_ids(row_ids, lstate.committed_sel, committed_count);
+	committed_ids.Flatten(committed_count);
+	auto &transaction = DuckTransaction::Get(context.client, tableref.catalog);
+	fetch_chunk.Reset();
+	table.Fetch(transaction, fetch_chunk, lstate.fetch_ids, committed_ids, committed_count, lstate.fetch_state);
+	auto fetch_count = fetch_chunk.size();
+	if (fetch_count == 0) {
+		return;
+	}
+	// the fetched rows are in the order of the row ids, so we can match them to the updated rows one by one
+	auto &fetched_ids = fetch_chunk.data.back();
+	auto fetched_id_data = FlatVector::GetData<row_t>(fetched_ids);
+	idx_t committed_idx = 0;
+	for (idx_t i = 0; i < fetch_count; i++) {
+		while (row_id_data[lstate.committed_sel.get_index(committed_idx)] != fetched_id_data[i]) {
+			committed_idx++;
+			D_ASSERT(committed_idx < committed_count);
+		}
+		lstate.fetch_sel.set_index(i, lstate.committed_sel.get_index(committed_idx++));
+	}
+
+	// delete the old rows, and append the new rows in the "standard table order"
+	auto &delete_state = lstate.GetDeleteState(table, tableref, context.client);
+	table.Delete(delete_state, context.client, fetched_ids, fetch_count);
+
+	mock_chunk.Reset();
+	for (idx_t i = 0; i < columns.size(); i++) {
+		mock_chunk.data[columns[i].index].Slice(update_chunk.data[i], lstate.fetch_sel, fetch_count);
+	}
+	for (idx_t i = 0; i + 1 < lstate.fetch_ids.size(); i++) {
+		mock_chunk.data[lstate.fetch_ids[i]].Reference(fetch_chunk.data[i]);
+	}
+	mock_chunk.SetCardinality(fetch_count);
+	table.LocalAppend(tableref, context.client, mock_chunk, bound_constraints);
+}
+
 SinkResultType PhysicalUpdate::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const {
 	auto &gstate = input.global_state.Cast<UpdateGlobalState>();
 	auto &lstate = input.local_state.Cast<UpdateLocalState>();
@@ -108,7 +222,13 @@ SinkResultType PhysicalUpdate::Sink(ExecutionContext &context, DataChunk &chunk,
 	}
 
 	lock_guard<mutex> glock(gstate.lock);
-	if (update_is_del_and_insert) {
+	if (!gstate.is_bulk_update && gstate.bulk_update_threshold > 0 &&
+	    gstate.updated_count >= gstate.bulk_update_threshold) {
+		gstate.is_bulk_update = true;
+	}
+	if (gstate.is_bulk_update) {
+		BulkUpdate(context, gstate, lstate, row_ids);
+	} else if (update_is_del_and_insert) {
 		// index update or update on complex type, perform a delete and an append instead
 
 		// figure out which rows have not yet been deleted in this update
@@ -157,7 +277,12 @@ SinkResultType PhysicalUpdate::Sink(ExecutionContext &context, DataChunk &chunk,
 }
 
 unique_ptr<GlobalSinkState> PhysicalUpdate::GetGlobalSinkState(ClientContext &context) const {
-	return make_uniq<UpdateGlobalState>(context, GetTypes());
+	auto result = make_uniq<UpdateGlobalState>(context, GetTypes());
+	// a bulk update deletes and re-appends the rows: this requires an update without indexes or RETURNING
+	if (!update_is_del_and_insert && !return_chunk && !table.HasIndexes()) {
+		result->bulk_update_threshold = ClientConfig::GetConfig(context).bulk_update_threshold;
+	}
+	return std::move(result);
 }
 
 unique_ptr<LocalSinkState> PhysicalUpdate::GetLocalSinkState(ExecutionContext &context) const {
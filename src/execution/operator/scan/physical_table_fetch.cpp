@@ -0,0 +1,109 @@
+#include "duckdb/execution/operator/scan/physical_table_fetch.hpp"
+
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
+#include "duckdb/transaction/local_storage.hpp"
+
+namespace duckdb {
+
+class TableFetchState : public OperatorState {
+public:
+	TableFetchState(ClientContext &context, const vector<LogicalType> &types)
+	    : committed_sel(STANDARD_VECTOR_SIZE), local_sel(STANDARD_VECTOR_SIZE), merge_sel(STANDARD_VECTOR_SIZE) {
+		committed_chunk.Initialize(context, types);
+		local_chunk.Initialize(context, types);
+	}
+
+	ColumnFetchState fetch_state;
+	//! Used to fetch the committed and the transaction-local rows separately, if the input contains both
+	SelectionVector committed_sel;
+	SelectionVector local_sel;
+	SelectionVector merge_sel;
+	DataChunk committed_chunk;
+	DataChunk local_chunk;
+};
+
+PhysicalTableFetch::PhysicalTableFetch(vector<LogicalType> types, DuckTableEntry &table, vector<column_t> column_ids,
+                                       idx_t row_id_index, idx_t estimated_cardinality)
+    : PhysicalOperator(PhysicalOperatorType::TABLE_FETCH, std::move(types), estimated_cardinality), table(table),
+      column_ids(std::move(column_ids)), row_id_index(row_id_index) {
+}
+
+unique_ptr<OperatorState> PhysicalTableFetch::GetOperatorState(ExecutionContext &context) const {
+	return make_uniq<TableFetchState>(context.client, types);
+}
+
+OperatorResultType PhysicalTableFetch::Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+                                               GlobalOperatorState &gstate, OperatorState &state_p) const {
+	auto &state = state_p.Cast<TableFetchState>();
+	auto &transaction = DuckTransaction::Get(context.client, table.catalog);
+	auto &storage = table.GetStorage();
+
+	auto &row_ids = input.data[row_id_index];
+	row_ids.Flatten(input.size());
+	auto row_id_data = FlatVector::GetData<row_t>(row_ids);
+
+	// rows that were appended by this transaction live in the local storage
+	idx_t committed_count = 0;
+	idx_t local_count = 0;
+	for (idx_t i = 0; i < input.size(); i++) {
+		if (row_id_data[i] >= MAX_ROW_ID) {
+			state.local_sel.set_index(local_count++, i);
+		} else {
+			state.committed_sel.set_index(committed_count++, i);
+		}
+	}
+	if (local_count == 0) {
+		// the rows are fetched in the order of the row ids in the input
+		storage.Fetch(transaction, chunk, column_ids, row_ids, input.size(), state.fetch_state);
+		return OperatorResultType::NEED_MORE_INPUT;
+	}
+
+	// fetch the committed and the local rows separately, and merge them back into the order of the input
+	state.committed_chunk.Reset();
+	state.local_chunk.Reset();
+	if (committed_count > 0) {
+		Vector committed_ids(row_ids, state.committed_sel, committed_count);
+		committed_ids.Flatten(committed_count);
+		storage.Fetch(transaction, state.committed_chunk, column_ids, committed_ids, committed_count,
+		              state.fetch_state);
+	}
+	Vector local_ids(row_ids, state.local_sel, local_count);
+	local_ids.Flatten(local_count);
+	auto &local_storage = LocalStorage::Get(transaction);
+	local_storage.FetchChunk(storage, local_ids, local_count, column_ids, state.local_chunk, state.fetch_state);
+	if (state.committed_chunk.size() != committed_count || state.local_chunk.size() != local_count) {
+		// the rows were produced by a scan in this transaction, so they are visible to it
+		throw InternalException("PhysicalTableFetch - could not fetch all rows");
+	}
+	// the local rows are appended after the committed rows
+	idx_t committed_idx = 0;
+	idx_t local_idx = 0;
+	for (idx_t i = 0; i < input.size(); i++) {
+		auto is_local = row_id_data[i] >= MAX_ROW_ID;
+		state.merge_sel.set_index(i, is_local ? committed_count + local_idx++ : committed_idx++);
+	}
+	chunk.Append(state.committed_chunk);
+	chunk.Append(state.local_chunk);
+	chunk.Slice(state.merge_sel, input.size());
+	return OperatorResultType::NEED_MORE_INPUT;
+}
+
+string PhysicalTableFetch::ParamsToString() const {
+	string result = table.name + "\n[INFOSEPARATOR]\n";
+	for (idx_t i = 0; i < column_ids.size(); i++) {
+		if (i > 0) {
+			result += "\n";
+		}
+		if (column_ids[i] == COLUMN_IDENTIFIER_ROW_ID) {
+			result += "rowid";
+		} else {
+			result += table.GetColumns().GetColumn(PhysicalIndex(column_ids[i])).Name();
+		}
+	}
+	return result;
+}
+
+} // namespace duckdb
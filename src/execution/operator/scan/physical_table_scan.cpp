@@ -3,6 +3,7 @@
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/planner/expression/bound_conjunction_expression.hpp"
+#include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/transaction/transaction.hpp"
 
 #include <utility>
@@ -99,6 +100,41 @@ string PhysicalTableScan::GetName() const {
 	return StringUtil::Upper(function.name + " " + function.extra_info);
 }
 
+//! Dynamic filters are only set during execution, so they are left out when rendering the filters
+static bool HasStaticFilter(TableFilter &filter) {
+	switch (filter.filter_type) {
+	case TableFilterType::DYNAMIC_FILTER:
+		return false;
+	case TableFilterType::CONJUNCTION_AND: {
+		for (auto &child_filter : filter.Cast<ConjunctionAndFilter>().child_filters) {
+			if (HasStaticFilter(*child_filter)) {
+				return true;
+			}
+		}
+		return false;
+	}
+	default:
+		return true;
+	}
+}
+
+static string StaticFilterToString(TableFilter &filter, const string &column_name) {
+	if (filter.filter_type != TableFilterType::CONJUNCTION_AND) {
+		return filter.ToString(column_name);
+	}
+	string result;
+	for (auto &child_filter : filter.Cast<ConjunctionAndFilter>().child_filters) {
+		if (!HasStaticFilter(*child_filter)) {
+			continue;
+		}
+		if (!result.empty()) {
+			result += " AND ";
+		}
+		result += StaticFilterToString(*child_filter, column_name);
+	}
+	return result;
+}
+
 string PhysicalTableScan::ParamsToString() const {
 	string result;
 	if (function.to_string) {
@@ -129,16 +165,24 @@ string PhysicalTableScan::ParamsToString() const {
 		}
 	}
 	if (function.filter_pushdown && table_filters) {
-		result += "\n[INFOSEPARATOR]\n";
-		result += "Filters: ";
+		string filters;
+		bool has_filters = false;
 		for (auto &f : table_filters->filters) {
 			auto &column_index = f.first;
 			auto &filter = f.second;
+			if (!HasStaticFilter(*filter)) {
+				continue;
+			}
+			has_filters = true;
 			if (column_index < names.size()) {
-				result += filter->ToString(names[column_ids[column_index]]);
-				result += "\n";
+				filters += StaticFilterToString(*filter, names[column_ids[column_index]]);
+				filters += "\n";
 			}
 		}
+		if (has_filters) {
+			result += "\n[INFOSEPARATOR]\n";
+			result += "Filters: " + filters;
+		}
 	}
 	if (!extra_info.file_filters.empty()) {
 		result += "\n[INFOSEPARATOR]\n";
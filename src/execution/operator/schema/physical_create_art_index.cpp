@@ -39,13 +39,24 @@ public:
 
 class CreateARTIndexLocalSinkState : public LocalSinkState {
 public:
-	explicit CreateARTIndexLocalSinkState(ClientContext &context) : arena_allocator(Allocator::Get(context)) {};
+	explicit CreateARTIndexLocalSinkState(ClientContext &context)
+	    : arena_allocator(Allocator::Get(context)), sorted_arena_allocator(Allocator::Get(context)) {};
 
 	unique_ptr<BoundIndex> local_index;
 	ArenaAllocator arena_allocator;
 	vector<ARTKey> keys;
 	DataChunk key_chunk;
 	vector<column_t> key_column_ids;
+
+	//! The sorted keys and row IDs that are not yet in the local index, if the data is sorted
+	ArenaAllocator sorted_arena_allocator;
+	vector<ARTKey> sorted_keys;
+	vector<row_t> sorted_row_ids;
+
+	//! Returns the memory held by the buffered sorted keys and row IDs
+	idx_t SortedBufferSize() const {
+		return sorted_arena_allocator.AllocationSize() + sorted_keys.size() * (sizeof(ARTKey) + sizeof(row_t));
+	}
 };
 
 unique_ptr<GlobalSinkState> PhysicalCreateARTIndex::GetGlobalSinkState(ClientContext &context) const {
@@ -97,23 +108,65 @@ SinkResultType PhysicalCreateARTIndex::SinkUnsorted(Vector &row_identifiers, Ope
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
+void PhysicalCreateARTIndex::ConstructSorted(LocalSinkState &lstate) const {
+
+	auto &l_state = lstate.Cast<CreateARTIndexLocalSinkState>();
+	if (l_state.sorted_keys.empty()) {
+		return;
+	}
+	auto &storage = table.GetStorage();
+	auto &l_index = l_state.local_index->Cast<ART>();
+	auto count = l_state.sorted_keys.size();
+
+	// construct the ART bottom-up from the sorted keys, directly in the local ART, if it is still empty
+	if (!l_index.tree.HasMetadata()) {
+		if (!l_index.ConstructFromSorted(count, l_state.sorted_keys, l_state.sorted_row_ids.data())) {
+			throw ConstraintException("Data contains duplicates on indexed column(s)");
+		}
+	} else {
+		auto art = make_uniq<ART>(info->index_name, l_index.GetConstraintType(), l_index.GetColumnIds(),
+		                          l_index.table_io_manager, l_index.unbound_expressions, storage.db,
+		                          l_index.allocators);
+		if (!art->ConstructFromSorted(count, l_state.sorted_keys, l_state.sorted_row_ids.data())) {
+			throw ConstraintException("Data contains duplicates on indexed column(s)");
+		}
+
+		// merge into the local ART
+		if (!l_state.local_index->MergeIndexes(*art)) {
+			throw ConstraintException("Data contains duplicates on indexed column(s)");
+		}
+	}
+
+	l_state.sorted_keys.clear();
+	l_state.sorted_row_ids.clear();
+	l_state.sorted_arena_allocator.Reset();
+}
+
 SinkResultType PhysicalCreateARTIndex::SinkSorted(Vector &row_identifiers, OperatorSinkInput &input) const {
 
 	auto &l_state = input.local_state.Cast<CreateARTIndexLocalSinkState>();
-	auto &storage = table.GetStorage();
-	auto &l_index = l_state.local_index;
+	auto count = l_state.key_chunk.size();
 
-	// create an ART from the chunk
-	auto art = make_uniq<ART>(info->index_name, l_index->GetConstraintType(), l_index->GetColumnIds(),
-	                          l_index->table_io_manager, l_index->unbound_expressions, storage.db,
-	                          l_index->Cast<ART>().allocators);
-	if (!art->ConstructFromSorted(l_state.key_chunk.size(), l_state.keys, row_identifiers)) {
-		throw ConstraintException("Data contains duplicates on indexed column(s)");
+	// get the corresponding row IDs
+	row_identifiers.Flatten(count);
+	auto row_ids = FlatVector::GetData<row_t>(row_identifiers);
+
+	// each thread receives ascending ranges of the sorted data, and the chunks of a range are sorted, too
+	// we buffer the keys until the range ends, and then construct the ART of the whole range at once, which avoids
+	// constructing and merging an ART per chunk
+	// the buffer lives outside the buffer manager, so we also construct the ART once the buffer exceeds its budget
+	if (!l_state.sorted_keys.empty() &&
+	    (l_state.sorted_keys.back() > l_state.keys[0] || l_state.SortedBufferSize() >= SORTED_BUFFER_SIZE)) {
+		ConstructSorted(l_state);
 	}
 
-	// merge into the local ART
-	if (!l_index->MergeIndexes(*art)) {
-		throw ConstraintException("Data contains duplicates on indexed column(s)");
+	// copy the keys, as the keys of the chunk are reset with the next chunk
+	for (idx_t i = 0; i < count; i++) {
+		auto &key = l_state.keys[i];
+		ARTKey sorted_key(l_state.sorted_arena_allocator, key.len);
+		memcpy(sorted_key.data, key.data, key.len);
+		l_state.sorted_keys.push_back(sorted_key);
+		l_state.sorted_row_ids.push_back(row_ids[i]);
 	}
 
 	return SinkResultType::NEED_MORE_INPUT;
@@ -143,6 +196,9 @@ SinkCombineResultType PhysicalCreateARTIndex::Combine(ExecutionContext &context,
 
 	auto &gstate = input.global_state.Cast<CreateARTIndexGlobalSinkState>();
 	auto &lstate = input.local_state.Cast<CreateARTIndexLocalSinkState>();
+	if (sorted) {
+		ConstructSorted(lstate);
+	}
 
 	// merge the local index into the global index
 	if (!gstate.global_index->MergeIndexes(*lstate.local_index)) {
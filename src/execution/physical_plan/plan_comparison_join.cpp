@@ -2,8 +2,11 @@
 #include "duckdb/execution/operator/join/physical_cross_product.hpp"
 #include "duckdb/execution/operator/join/physical_hash_join.hpp"
 #include "duckdb/execution/operator/join/physical_iejoin.hpp"
+#include "duckdb/execution/operator/join/physical_index_join.hpp"
 #include "duckdb/execution/operator/join/physical_nested_loop_join.hpp"
 #include "duckdb/execution/operator/join/physical_piecewise_merge_join.hpp"
+#include "duckdb/execution/operator/filter/physical_filter.hpp"
+#include "duckdb/execution/operator/projection/physical_projection.hpp"
 #include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/function/table/table_scan.hpp"
@@ -14,7 +17,11 @@
 #include "duckdb/execution/operator/join/physical_blockwise_nl_join.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
 #include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/execution/index/art/art.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table/data_table_info.hpp"
 
 namespace duckdb {
 
@@ -152,6 +159,267 @@ bool PhysicalPlanGenerator::HasEquality(vector<JoinCondition> &conds, idx_t &ran
 	return false;
 }
 
+optional_ptr<PhysicalTableScan> PhysicalPlanGenerator::FindDynamicFilterScan(PhysicalOperator &op, idx_t &column_idx) {
+	switch (op.type) {
+	case PhysicalOperatorType::PROJECTION: {
+		auto &expr = *op.Cast<PhysicalProjection>().select_list[column_idx];
+		if (expr.GetExpressionClass() != ExpressionClass::BOUND_REF) {
+			return nullptr;
+		}
+		column_idx = expr.Cast<BoundReferenceExpression>().index;
+		return FindDynamicFilterScan(*op.children[0], column_idx);
+	}
+	case PhysicalOperatorType::FILTER:
+		return FindDynamicFilterScan(*op.children[0], column_idx);
+	case PhysicalOperatorType::TABLE_SCAN: {
+		auto &scan = op.Cast<PhysicalTableScan>();
+		if (!scan.function.filter_pushdown || !scan.function.dynamic_filter_pushdown) {
+			return nullptr;
+		}
+		if (!scan.projection_ids.empty()) {
+			column_idx = scan.projection_ids[column_idx];
+		}
+		if (scan.column_ids[column_idx] == COLUMN_IDENTIFIER_ROW_ID) {
+			return nullptr;
+		}
+		return &scan;
+	}
+	default:
+		return nullptr;
+	}
+}
+
+//! Pushes dynamic filters on the build side keys of the hash join into the table scans on the probe side, which are
+//! set once the build side is finished
+static void PlanJoinFilterPushdown(PhysicalHashJoin &join) {
+	if (!join.CanPushDownJoinFilters()) {
+		return;
+	}
+	for (idx_t cond_idx = 0; cond_idx < join.conditions.size(); cond_idx++) {
+		auto &cond = join.conditions[cond_idx];
+		if (cond.comparison != ExpressionType::COMPARE_EQUAL ||
+		    cond.left->GetExpressionClass() != ExpressionClass::BOUND_REF) {
+			continue;
+		}
+		if (!PhysicalHashJoin::CanPushDownRangeFilter(cond.left->return_type) &&
+		    (join.conditions.size() != 1 || cond.left->return_type.IsNested())) {
+			// neither the range filter nor the Bloom filter can be used
+			continue;
+		}
+		auto column_idx = cond.left->Cast<BoundReferenceExpression>().index;
+		auto scan = PhysicalPlanGenerator::FindDynamicFilterScan(*join.children[0], column_idx);
+		if (!scan) {
+			continue;
+		}
+		auto filter_data = make_shared_ptr<DynamicFilterData>();
+		if (!scan->table_filters) {
+			scan->table_filters = make_uniq<TableFilterSet>();
+		}
+		scan->table_filters->PushFilter(column_idx, make_uniq<DynamicFilter>(filter_data));
+
+		JoinFilterPushdownColumn pushdown;
+		pushdown.condition_idx = cond_idx;
+		pushdown.filter_data = std::move(filter_data);
+		join.filter_pushdown.push_back(std::move(pushdown));
+	}
+}
+
+//! Checks a Bloom filter over the build side keys before probing the hash table if most probe side keys are expected
+//! not to have a match, as the Bloom filter is much smaller than the hash table and its tuples
+static void PlanBloomFilterProbe(PhysicalHashJoin &join) {
+	// the probe side must be at least this many times larger than the build side to assume a low hit rate
+	static constexpr const idx_t BLOOM_FILTER_MIN_PROBE_RATIO = 10;
+	const auto probe_cardinality = join.children[0]->estimated_cardinality;
+	if (probe_cardinality == 0 || join.perfect_join_statistics.is_build_small) {
+		return;
+	}
+	const auto join_cardinality = MinValue<double>(double(join.estimated_cardinality), double(probe_cardinality));
+	double hit_rate;
+	switch (join.join_type) {
+	case JoinType::INNER:
+	case JoinType::SEMI:
+		hit_rate = join_cardinality / double(probe_cardinality);
+		break;
+	case JoinType::ANTI:
+		hit_rate = 1.0 - join_cardinality / double(probe_cardinality);
+		break;
+	default:
+		// the estimate does not tell us how many of the probe side keys have a match
+		return;
+	}
+	// the join estimate often defaults to the probe side cardinality, which says nothing about the hit rate
+	// a build side that is much smaller than the probe side is then a better hint that most keys have no match
+	const auto build_cardinality = join.children[1]->estimated_cardinality;
+	const auto small_build = build_cardinality * BLOOM_FILTER_MIN_PROBE_RATIO <= probe_cardinality;
+	// this is checked again during execution, based on the keys that are actually probed
+	join.bloom_filter_probe = hit_rate <= JoinHashTable::BLOOM_FILTER_MAX_PASS_RATE || small_build;
+}
+
+//! Returns the ART index on the column of the base table that is scanned by "op" and read by the join key "key"
+static optional_ptr<ART> FindJoinIndex(ClientContext &context, PhysicalOperator &op, Expression &key) {
+	if (op.type == PhysicalOperatorType::FILTER && op.children[0]->type == PhysicalOperatorType::TABLE_SCAN) {
+		// the filter emits the columns of the scan, and is applied to the fetched rows
+		return FindJoinIndex(context, *op.children[0], key);
+	}
+	if (op.type != PhysicalOperatorType::TABLE_SCAN || key.GetExpressionClass() != ExpressionClass::BOUND_REF) {
+		return nullptr;
+	}
+	auto &scan = op.Cast<PhysicalTableScan>();
+	if (scan.function.name != "seq_scan" || !scan.bind_data) {
+		return nullptr;
+	}
+	auto &bind_data = scan.bind_data->Cast<TableScanBindData>();
+	if (bind_data.is_index_scan || bind_data.is_create_index) {
+		return nullptr;
+	}
+	auto column_idx = key.Cast<BoundReferenceExpression>().index;
+	if (!scan.projection_ids.empty()) {
+		column_idx = scan.projection_ids[column_idx];
+	}
+	auto column_id = scan.column_ids[column_idx];
+	if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+		return nullptr;
+	}
+
+	auto &storage = bind_data.table.GetStorage();
+	auto checkpoint_lock = storage.GetSharedCheckpointLock();
+	auto &info = storage.GetDataTableInfo();
+	optional_ptr<ART> result;
+	info->GetIndexes().BindAndScan<ART>(context, *info, [&](ART &art) {
+		auto &index_columns = art.GetColumnIds();
+		if (art.unbound_expressions.size() != 1 || index_columns.size() != 1 || index_columns[0] != column_id ||
+		    art.unbound_expressions[0]->type != ExpressionType::BOUND_COLUMN_REF ||
+		    art.logical_types[0] != key.return_type) {
+			return false;
+		}
+		result = &art;
+		return true;
+	});
+	return result;
+}
+
+//! Plans an index join if one side of an inner equality join is a scan of a base table with an ART index on the join
+//! column, and the other side is much smaller than the table. The index join looks up the keys of the other side in
+//! the index, instead of scanning the table and building or probing a hash table
+static unique_ptr<PhysicalOperator> PlanIndexJoin(ClientContext &context, LogicalComparisonJoin &op,
+                                                  unique_ptr<PhysicalOperator> &left,
+                                                  unique_ptr<PhysicalOperator> &right) {
+	// the outer side must be at least this many times smaller than the table
+	static constexpr const idx_t INDEX_JOIN_MIN_RATIO = 100;
+	if (op.join_type != JoinType::INNER || op.conditions.size() != 1 ||
+	    op.conditions[0].comparison != ExpressionType::COMPARE_EQUAL) {
+		return nullptr;
+	}
+	auto &cond = op.conditions[0];
+	const auto force_index_join = ClientConfig::GetConfig(context).force_index_join;
+	auto left_index = FindJoinIndex(context, *left, *cond.left);
+	auto right_index = FindJoinIndex(context, *right, *cond.right);
+	if (left_index && right_index) {
+		// use the index on the larger side
+		if (left->estimated_cardinality >= right->estimated_cardinality) {
+			right_index = nullptr;
+		} else {
+			left_index = nullptr;
+		}
+	}
+	if (left_index && !force_index_join &&
+	    right->estimated_cardinality * INDEX_JOIN_MIN_RATIO > left->estimated_cardinality) {
+		left_index = nullptr;
+	}
+	if (right_index && !force_index_join &&
+	    left->estimated_cardinality * INDEX_JOIN_MIN_RATIO > right->estimated_cardinality) {
+		right_index = nullptr;
+	}
+	if (!left_index && !right_index) {
+		return nullptr;
+	}
+
+	const bool inner_is_left = left_index != nullptr;
+	auto &index = inner_is_left ? *left_index : *right_index;
+	auto &inner = inner_is_left ? left : right;
+	auto &outer = inner_is_left ? right : left;
+	auto &inner_projection_map = inner_is_left ? op.left_projection_map : op.right_projection_map;
+	auto &outer_projection_map = inner_is_left ? op.right_projection_map : op.left_projection_map;
+	auto &outer_key = inner_is_left ? cond.right : cond.left;
+
+	// the emitted columns of the table are fetched by their row ids
+	// a filter on top of the scan is applied to the fetched rows, like the filters of the scan itself
+	optional_ptr<PhysicalFilter> filter;
+	if (inner->type == PhysicalOperatorType::FILTER) {
+		filter = &inner->Cast<PhysicalFilter>();
+	}
+	auto &scan = (filter ? *inner->children[0] : *inner).Cast<PhysicalTableScan>();
+	auto &table = scan.bind_data->Cast<TableScanBindData>().table;
+	// the index no longer has the rows of deletes that committed after this transaction started, so we cannot use it
+	auto &transaction = DuckTransaction::Get(context, table.catalog);
+	if (!table.GetStorage().GetDataTableInfo()->IndexesContainVisibleRows(transaction.start_time)) {
+		return nullptr;
+	}
+	vector<column_t> scan_columns;
+	if (scan.projection_ids.empty()) {
+		scan_columns = scan.column_ids;
+	} else {
+		for (auto &projection_id : scan.projection_ids) {
+			scan_columns.push_back(scan.column_ids[projection_id]);
+		}
+	}
+	vector<idx_t> inner_columns = inner_projection_map;
+	if (inner_columns.empty()) {
+		for (idx_t i = 0; i < scan_columns.size(); i++) {
+			inner_columns.push_back(i);
+		}
+	}
+	vector<column_t> fetch_ids;
+	vector<LogicalType> fetch_types;
+	// returns the position of the column in the fetched chunk, and adds the column if it is not fetched yet
+	auto fetch_column = [&](column_t column_id, bool emitted) {
+		auto storage_id = column_id;
+		LogicalType type = LogicalType::ROW_TYPE;
+		if (column_id != COLUMN_IDENTIFIER_ROW_ID) {
+			auto &column = table.GetColumn(LogicalIndex(column_id));
+			storage_id = column.StorageOid();
+			type = column.Type();
+		}
+		idx_t fetch_idx = 0;
+		while (!emitted && fetch_idx < fetch_ids.size() && fetch_ids[fetch_idx] != storage_id) {
+			fetch_idx++;
+		}
+		if (emitted || fetch_idx == fetch_ids.size()) {
+			fetch_idx = fetch_ids.size();
+			fetch_ids.push_back(storage_id);
+			fetch_types.push_back(std::move(type));
+		}
+		return fetch_idx;
+	};
+	// the emitted columns come first, followed by the columns that are only filtered on
+	for (auto &column_idx : inner_columns) {
+		fetch_column(scan_columns[column_idx], true);
+	}
+	// the filters of the scan are keyed by their column in the scan, which we map to their column in the fetched chunk
+	unique_ptr<TableFilterSet> table_filters;
+	if (scan.table_filters && !scan.table_filters->filters.empty()) {
+		table_filters = make_uniq<TableFilterSet>();
+		for (auto &entry : scan.table_filters->filters) {
+			auto fetch_idx = fetch_column(scan.column_ids[entry.first], false);
+			table_filters->filters[fetch_idx] = std::move(entry.second);
+		}
+	}
+	// the filter expression references the columns emitted by the scan, which we map to the fetched chunk as well
+	unique_ptr<Expression> filter_expression;
+	if (filter) {
+		filter_expression = std::move(filter->expression);
+		ExpressionIterator::EnumerateExpression(filter_expression, [&](Expression &child) {
+			if (child.GetExpressionClass() == ExpressionClass::BOUND_REF) {
+				auto &ref = child.Cast<BoundReferenceExpression>();
+				ref.index = fetch_column(scan_columns[ref.index], false);
+			}
+		});
+	}
+	return make_uniq<PhysicalIndexJoin>(op.types, std::move(outer), std::move(outer_key), outer_projection_map, table,
+	                                    index, std::move(fetch_ids), std::move(fetch_types), std::move(table_filters),
+	                                    std::move(filter_expression), inner_is_left, op.estimated_cardinality);
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanComparisonJoin(LogicalComparisonJoin &op) {
 	// now visit the children
 	D_ASSERT(op.children.size() == 2);
@@ -167,6 +435,12 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanComparisonJoin(LogicalCo
 		// no conditions: insert a cross product
 		return make_uniq<PhysicalCrossProduct>(op.types, std::move(left), std::move(right), op.estimated_cardinality);
 	}
+	if (op.type == LogicalOperatorType::LOGICAL_COMPARISON_JOIN) {
+		auto index_join = PlanIndexJoin(context, op, left, right);
+		if (index_join) {
+			return index_join;
+		}
+	}
 
 	idx_t has_range = 0;
 	bool has_equality = HasEquality(op.conditions, has_range);
@@ -196,6 +470,11 @@ unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanComparisonJoin(LogicalCo
 		plan = make_uniq<PhysicalHashJoin>(op, std::move(left), std::move(right), std::move(op.conditions),
 		                                   op.join_type, op.left_projection_map, op.right_projection_map,
 		                                   std::move(op.mark_types), op.estimated_cardinality, perfect_join_stats);
+		if (op.type == LogicalOperatorType::LOGICAL_COMPARISON_JOIN) {
+			// the probe side of a delim join is not scanned after the build, so we only do this for regular joins
+			PlanJoinFilterPushdown(plan->Cast<PhysicalHashJoin>());
+		}
+		PlanBloomFilterProbe(plan->Cast<PhysicalHashJoin>());
 
 	} else {
 		static constexpr const idx_t NESTED_LOOP_JOIN_THRESHOLD = 5;
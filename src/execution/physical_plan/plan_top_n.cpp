@@ -1,17 +1,331 @@
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
 #include "duckdb/execution/operator/order/physical_top_n.hpp"
+#include "duckdb/execution/operator/projection/physical_projection.hpp"
+#include "duckdb/execution/operator/scan/physical_table_fetch.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
+#include "duckdb/function/table/table_scan.hpp"
+#include "duckdb/main/client_config.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/planner/operator/logical_projection.hpp"
 #include "duckdb/planner/operator/logical_top_n.hpp"
 
 namespace duckdb {
 
+//! Returns the columns of the table that are emitted by a table scan
+static vector<column_t> GetScanOutputColumns(const LogicalGet &get) {
+	if (get.projection_ids.empty()) {
+		return get.column_ids;
+	}
+	vector<column_t> result;
+	for (auto &projection_id : get.projection_ids) {
+		result.push_back(get.column_ids[projection_id]);
+	}
+	return result;
+}
+
+//! Whether or not the boundary of a TopN on a column of the given type can be used to prune row groups
+static bool CanPushDownTopNBoundary(const LogicalType &type) {
+	// no floating point types: NaN sorts after all other values, but is not within the min/max
+	switch (type.id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::HUGEINT:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::UBIGINT:
+	case LogicalTypeId::UHUGEINT:
+	case LogicalTypeId::DECIMAL:
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::TIME:
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_SEC:
+	case LogicalTypeId::TIMESTAMP_MS:
+	case LogicalTypeId::TIMESTAMP_NS:
+	case LogicalTypeId::TIMESTAMP_TZ:
+	case LogicalTypeId::VARCHAR:
+		return true;
+	default:
+		return false;
+	}
+}
+
+//! Pushes a dynamic filter on the first order column of the TopN into the table scan that produces it. While the
+//! TopN runs, the filter is set to the boundary of its heap, which allows the scan to skip row groups that cannot make
+//! it into the top-n
+static void PlanTopNFilterPushdown(PhysicalTopN &top_n) {
+	auto &order = top_n.orders[0];
+	if (order.expression->GetExpressionClass() != ExpressionClass::BOUND_REF ||
+	    !CanPushDownTopNBoundary(order.expression->return_type)) {
+		return;
+	}
+	if (order.null_order != OrderByNullType::NULLS_LAST) {
+		// NULL values come first, but are never within the boundary
+		return;
+	}
+	if (top_n.limit == 0) {
+		return;
+	}
+	auto column_idx = order.expression->Cast<BoundReferenceExpression>().index;
+	auto scan = PhysicalPlanGenerator::FindDynamicFilterScan(*top_n.children[0], column_idx);
+	if (!scan) {
+		return;
+	}
+	auto filter_data = make_shared_ptr<DynamicFilterData>();
+	if (!scan->table_filters) {
+		scan->table_filters = make_uniq<TableFilterSet>();
+	}
+	scan->table_filters->PushFilter(column_idx, make_uniq<DynamicFilter>(filter_data));
+	top_n.dynamic_filter = std::move(filter_data);
+}
+
+//! Replaces the scan of a base table below the TopN with a scan of an ART index on the first order column, which emits
+//! the rows with the smallest (or largest) keys first. The TopN still sorts the rows, the index only has to emit the
+//! rows that can make it into the top-n, instead of all rows of the table
+static bool PlanIndexOrderScan(ClientContext &context, LogicalTopN &op) {
+	if (!ClientConfig::GetConfig(context).enable_optimizer) {
+		return false;
+	}
+	auto &order = op.orders[0];
+	if (order.expression->GetExpressionClass() != ExpressionClass::BOUND_REF ||
+	    !CanPushDownTopNBoundary(order.expression->return_type)) {
+		return false;
+	}
+	if (order.null_order != OrderByNullType::NULLS_LAST) {
+		// NULL values are not in the index
+		return false;
+	}
+	if (order.expression->return_type.id() == LogicalTypeId::VARCHAR) {
+		// the keys of strings in the index are not ordered by their collation
+		return false;
+	}
+	auto limit = NumericCast<idx_t>(op.limit);
+	auto offset = NumericCast<idx_t>(op.offset);
+	if (limit == 0 || offset > NumericLimits<idx_t>::Maximum() - limit) {
+		return false;
+	}
+	auto column_idx = order.expression->Cast<BoundReferenceExpression>().index;
+	reference<LogicalOperator> child = *op.children[0];
+	if (child.get().type == LogicalOperatorType::LOGICAL_PROJECTION) {
+		auto &expr = *child.get().expressions[column_idx];
+		if (expr.type != ExpressionType::BOUND_REF) {
+			return false;
+		}
+		column_idx = expr.Cast<BoundReferenceExpression>().index;
+		child = *child.get().children[0];
+	}
+	if (child.get().type != LogicalOperatorType::LOGICAL_GET) {
+		return false;
+	}
+	auto &get = child.get().Cast<LogicalGet>();
+	if (!get.children.empty() || get.function.name != "seq_scan" || !get.bind_data ||
+	    !get.table_filters.filters.empty()) {
+		return false;
+	}
+	// without table filters, the scan emits all the columns it reads: the index order scan does not prune columns
+	for (idx_t i = 0; i < get.projection_ids.size(); i++) {
+		if (get.projection_ids[i] != i) {
+			return false;
+		}
+	}
+	if (!get.projection_ids.empty() && get.projection_ids.size() != get.column_ids.size()) {
+		return false;
+	}
+	auto &bind_data = get.bind_data->Cast<TableScanBindData>();
+	if (bind_data.is_index_scan || bind_data.is_create_index) {
+		return false;
+	}
+	auto column_id = get.column_ids[column_idx];
+	if (column_id == COLUMN_IDENTIFIER_ROW_ID || bind_data.table.GetColumn(LogicalIndex(column_id)).Generated()) {
+		return false;
+	}
+	// only use the index if the top-n is a small fraction of the table
+	auto row_count = limit + offset;
+	auto table_rows = bind_data.table.GetStorage().GetTotalRows();
+	if (row_count > table_rows / 16) {
+		return false;
+	}
+	if (!TableScanFunction::HasOrderIndex(context, bind_data.table, column_id)) {
+		return false;
+	}
+	bind_data.order_column = column_id;
+	bind_data.order_descending = order.type == OrderType::DESCENDING;
+	bind_data.order_row_count = row_count;
+	get.function = TableScanFunction::GetIndexOrderScanFunction();
+	get.projection_ids.clear();
+	return true;
+}
+
+unique_ptr<PhysicalOperator> PhysicalPlanGenerator::PlanLateMaterialization(LogicalTopN &op) {
+	auto max_rows = ClientConfig::GetConfig(context).late_materialization_max_rows;
+	if (op.limit > max_rows || op.offset > max_rows - op.limit) {
+		return nullptr;
+	}
+	// the input of the TopN must be a scan of a base table, optionally through a projection
+	reference<LogicalOperator> child = *op.children[0];
+	optional_ptr<LogicalOperator> projection;
+	if (child.get().type == LogicalOperatorType::LOGICAL_PROJECTION) {
+		projection = &child.get();
+		child = *child.get().children[0];
+	}
+	if (child.get().type != LogicalOperatorType::LOGICAL_GET) {
+		return nullptr;
+	}
+	auto &get = child.get().Cast<LogicalGet>();
+	if (!get.children.empty() || get.function.name != "seq_scan" || !get.function.projection_pushdown ||
+	    !get.function.filter_prune || !get.bind_data) {
+		return nullptr;
+	}
+	auto &bind_data = get.bind_data->Cast<TableScanBindData>();
+	if (bind_data.is_index_scan || bind_data.is_create_index) {
+		return nullptr;
+	}
+	auto scan_columns = GetScanOutputColumns(get);
+	auto fetch_types = get.types;
+	// maps the columns of the input of the TopN to the columns emitted by the scan, or to INVALID_INDEX if they are
+	// computed by the projection
+	vector<idx_t> input_map;
+	if (projection) {
+		for (auto &expr : projection->expressions) {
+			if (expr->type == ExpressionType::BOUND_REF) {
+				input_map.push_back(expr->Cast<BoundReferenceExpression>().index);
+			} else {
+				input_map.push_back(DConstants::INVALID_INDEX);
+			}
+		}
+	} else {
+		for (idx_t i = 0; i < scan_columns.size(); i++) {
+			input_map.push_back(i);
+		}
+	}
+
+	// collect the columns that are referenced by the orders, these are the only columns the TopN has to carry along
+	vector<idx_t> order_columns;
+	unordered_map<idx_t, idx_t> order_column_map;
+	bool orders_computed_columns = false;
+	for (auto &order : op.orders) {
+		ExpressionIterator::EnumerateExpression(order.expression, [&](Expression &expr) {
+			if (expr.type != ExpressionType::BOUND_REF) {
+				return;
+			}
+			auto scan_idx = input_map[expr.Cast<BoundReferenceExpression>().index];
+			if (scan_idx == DConstants::INVALID_INDEX) {
+				orders_computed_columns = true;
+				return;
+			}
+			if (order_column_map.find(scan_idx) == order_column_map.end()) {
+				order_column_map[scan_idx] = order_columns.size();
+				order_columns.push_back(scan_idx);
+			}
+		});
+	}
+	if (orders_computed_columns) {
+		// the columns computed by the projection would have to be computed before the TopN
+		return nullptr;
+	}
+	bool has_payload = false;
+	for (auto &scan_idx : input_map) {
+		if (order_column_map.find(scan_idx) == order_column_map.end()) {
+			has_payload = true;
+			break;
+		}
+	}
+	if (!has_payload) {
+		// all emitted columns are required for the ordering: nothing to gain
+		return nullptr;
+	}
+
+	// rewrite the scan to only emit the order columns and the row ids
+	vector<column_t> column_ids;
+	vector<idx_t> projection_ids;
+	vector<LogicalType> scan_types;
+	optional_idx row_id_index;
+	for (auto &scan_idx : order_columns) {
+		if (scan_columns[scan_idx] == COLUMN_IDENTIFIER_ROW_ID) {
+			row_id_index = column_ids.size();
+		}
+		projection_ids.push_back(column_ids.size());
+		column_ids.push_back(scan_columns[scan_idx]);
+		scan_types.push_back(get.types[scan_idx]);
+	}
+	if (!row_id_index.IsValid()) {
+		row_id_index = column_ids.size();
+		projection_ids.push_back(column_ids.size());
+		column_ids.push_back(COLUMN_IDENTIFIER_ROW_ID);
+		scan_types.push_back(LogicalType::ROW_TYPE);
+	}
+	// the columns with table filters are still scanned, but not emitted
+	for (auto &entry : get.table_filters.filters) {
+		if (std::find(column_ids.begin(), column_ids.end(), entry.first) == column_ids.end()) {
+			column_ids.push_back(entry.first);
+		}
+	}
+	get.column_ids = std::move(column_ids);
+	get.projection_ids = std::move(projection_ids);
+	get.types = scan_types;
+	auto scan = CreatePlan(get);
+
+	for (auto &order : op.orders) {
+		ExpressionIterator::EnumerateExpression(order.expression, [&](Expression &expr) {
+			if (expr.type != ExpressionType::BOUND_REF) {
+				return;
+			}
+			auto &bound_ref = expr.Cast<BoundReferenceExpression>();
+			bound_ref.index = order_column_map[input_map[bound_ref.index]];
+		});
+	}
+	auto top_n = make_uniq<PhysicalTopN>(std::move(scan_types), std::move(op.orders), NumericCast<idx_t>(op.limit),
+	                                     NumericCast<idx_t>(op.offset), op.estimated_cardinality);
+	top_n->children.push_back(std::move(scan));
+	PlanTopNFilterPushdown(*top_n);
+
+	// fetch the columns emitted by the original scan of the selected rows by their row id
+	auto &table = bind_data.table;
+	vector<column_t> fetch_ids;
+	for (auto &column_id : scan_columns) {
+		if (column_id == COLUMN_IDENTIFIER_ROW_ID) {
+			fetch_ids.push_back(column_id);
+		} else {
+			fetch_ids.push_back(table.GetColumn(LogicalIndex(column_id)).StorageOid());
+		}
+	}
+	auto fetch = make_uniq<PhysicalTableFetch>(std::move(fetch_types), table, std::move(fetch_ids),
+	                                           row_id_index.GetIndex(), op.estimated_cardinality);
+	fetch->children.push_back(std::move(top_n));
+	if (!projection) {
+		return std::move(fetch);
+	}
+	// the projection is evaluated on the fetched rows
+	auto result = make_uniq<PhysicalProjection>(projection->types, std::move(projection->expressions),
+	                                            op.estimated_cardinality);
+	result->children.push_back(std::move(fetch));
+	return std::move(result);
+}
+
 unique_ptr<PhysicalOperator> PhysicalPlanGenerator::CreatePlan(LogicalTopN &op) {
 	D_ASSERT(op.children.size() == 1);
 
+	// index order scan: only emit the rows with the smallest (or largest) keys of an index on the first order column
+	if (!PlanIndexOrderScan(context, op)) {
+		// late materialization: only sort the order columns and the row ids, and fetch the other columns afterwards
+		auto late_materialized = PlanLateMaterialization(op);
+		if (late_materialized) {
+			return late_materialized;
+		}
+	}
+
 	auto plan = CreatePlan(*op.children[0]);
 
 	auto top_n = make_uniq<PhysicalTopN>(op.types, std::move(op.orders), NumericCast<idx_t>(op.limit),
 	                                     NumericCast<idx_t>(op.offset), op.estimated_cardinality);
 	top_n->children.push_back(std::move(plan));
+	PlanTopNFilterPushdown(*top_n);
 	return std::move(top_n);
 }
 
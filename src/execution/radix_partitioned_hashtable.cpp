@@ -141,6 +141,11 @@ public:
 	static constexpr const double BLOCK_FILL_FACTOR = 1.8;
 	//! By how many bits to repartition if a repartition is triggered
 	static constexpr const idx_t REPARTITION_RADIX_BITS = 2;
+
+	//! If the thread-local HT creates more groups than this fraction of the rows, pre-aggregation is bypassed
+	static constexpr const double SKIP_LOOKUPS_THRESHOLD = 0.9;
+	//! For how many times the capacity of the HT pre-aggregation is bypassed before we check the reduction again
+	static constexpr const idx_t SKIP_LOOKUPS_PHASES = 4;
 };
 
 class RadixHTGlobalSinkState : public GlobalSinkState {
@@ -329,9 +334,15 @@ public:
 
 	//! Data that is abandoned ends up here (only if we're doing external aggregation)
 	unique_ptr<PartitionedTupleData> abandoned_data;
+
+	//! Number of rows that were sunk since the HT was last reset
+	idx_t sink_count;
+	//! Number of times that the HT was filled since pre-aggregation was bypassed
+	idx_t skipped_phases;
 };
 
-RadixHTLocalSinkState::RadixHTLocalSinkState(ClientContext &, const RadixPartitionedHashTable &radix_ht) {
+RadixHTLocalSinkState::RadixHTLocalSinkState(ClientContext &, const RadixPartitionedHashTable &radix_ht)
+    : sink_count(0), skipped_phases(0) {
 	// If there are no groups we create a fake group so everything has the same group
 	group_chunk.InitializeEmpty(radix_ht.group_types);
 	if (radix_ht.grouping_set.empty()) {
@@ -434,6 +445,24 @@ bool MaybeRepartition(ClientContext &context, RadixHTGlobalSinkState &gstate, Ra
 	return true;
 }
 
+//! Decides whether the thread-local HT should bypass pre-aggregation. If the HT hardly reduces the number of rows
+//! (e.g., when grouping by near-unique keys), looking up the groups is wasted effort: the rows are appended to the
+//! partitions as-is, and are only combined during the Finalize. Every so often, we try pre-aggregating again, in
+//! case the locality of the groups has improved
+static void DecideAdaptation(RadixHTGlobalSinkState &gstate, RadixHTLocalSinkState &lstate, const idx_t group_count) {
+	auto &ht = *lstate.ht;
+	if (ht.SkipLookups()) {
+		if (++lstate.skipped_phases >= gstate.config.SKIP_LOOKUPS_PHASES) {
+			ht.SetSkipLookups(false);
+		}
+	} else if (static_cast<double>(group_count) >
+	           gstate.config.SKIP_LOOKUPS_THRESHOLD * static_cast<double>(lstate.sink_count)) {
+		ht.SetSkipLookups(true);
+		lstate.skipped_phases = 0;
+	}
+	lstate.sink_count = 0;
+}
+
 void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input,
                                      DataChunk &payload_input, const unsafe_vector<idx_t> &filter) const {
 	auto &gstate = input.global_state.Cast<RadixHTGlobalSinkState>();
@@ -448,16 +477,22 @@ void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk
 
 	auto &ht = *lstate.ht;
 	ht.AddChunk(group_chunk, payload_input, filter);
+	lstate.sink_count += chunk.size();
 
-	if (ht.Count() + STANDARD_VECTOR_SIZE < ht.ResizeThreshold()) {
+	// If we skip lookups, the HT does not fill up: we check after sinking as many rows as the HT can hold
+	const auto fill_count = ht.SkipLookups() ? lstate.sink_count : ht.Count();
+	if (fill_count + STANDARD_VECTOR_SIZE < ht.ResizeThreshold()) {
 		return; // We can fit another chunk
 	}
 
 	if (gstate.number_of_threads > 2) {
 		// 'Reset' the HT without taking its data, we can just keep appending to the same collection
 		// This only works because we never resize the HT
+		const auto group_count = ht.Count();
 		ht.ClearPointerTable();
 		ht.ResetCount();
+		// The data is combined during the Finalize anyway, so we can bypass pre-aggregation if it is not effective
+		DecideAdaptation(gstate, lstate, group_count);
 		// We don't do this when running with 1 or 2 threads, it only makes sense when there's many threads
 	}
 
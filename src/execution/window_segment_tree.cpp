@@ -6,6 +6,7 @@
 #include "duckdb/execution/merge_sort_tree.hpp"
 #include "duckdb/planner/expression/bound_constant_expression.hpp"
 #include "duckdb/execution/window_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 
 #include <numeric>
 #include <utility>
@@ -599,7 +600,8 @@ void WindowNaiveAggregator::Evaluate(WindowAggregatorState &lstate, const DataCh
 //===--------------------------------------------------------------------===//
 WindowSegmentTree::WindowSegmentTree(AggregateObject aggr, const LogicalType &result_type, WindowAggregationMode mode_p,
                                      const WindowExcludeMode exclude_mode_p, idx_t count)
-    : WindowAggregator(std::move(aggr), result_type, exclude_mode_p, count), internal_nodes(0), mode(mode_p) {
+    : WindowAggregator(std::move(aggr), result_type, exclude_mode_p, count), internal_nodes(0), mode(mode_p),
+      tasks_total(0), tasks_claimed(0), tasks_completed(0) {
 }
 
 void WindowSegmentTree::Finalize(const FrameStats &stats) {
@@ -843,43 +845,111 @@ void WindowSegmentTree::ConstructTree() {
 	//	Use a temporary scan state to build the tree
 	auto &gtstate = gstate->Cast<WindowSegmentTreeState>().part;
 
-	// compute space required to store internal nodes of segment tree
-	internal_nodes = 0;
-	idx_t level_nodes = inputs.size();
-	do {
-		level_nodes = (level_nodes + (TREE_FANOUT - 1)) / TREE_FANOUT;
-		internal_nodes += level_nodes;
-	} while (level_nodes > 1);
-	levels_flat_native = make_unsafe_uniq_array<data_t>(internal_nodes * state_size);
+	// compute the location of every level, and the space required to store internal nodes of segment tree
+	// level 0 is data itself
 	levels_flat_start.push_back(0);
+	idx_t level_size = inputs.size();
+	while (level_size > 1) {
+		level_size = (level_size + (TREE_FANOUT - 1)) / TREE_FANOUT;
+		levels_flat_start.push_back(levels_flat_start.back() + level_size);
+	}
+	internal_nodes = MaxValue<idx_t>(levels_flat_start.back(), 1);
+	levels_flat_native = make_unsafe_uniq_array<data_t>(internal_nodes * state_size);
 
-	idx_t levels_flat_offset = 0;
+	// the lower levels of large trees are computed by tasks, which other threads can claim using AssistFinalize
 	idx_t level_current = 0;
-	// level 0 is data itself
-	idx_t level_size;
-	// iterate over the levels of the segment tree
-	while ((level_size =
-	            (level_current == 0 ? inputs.size() : levels_flat_offset - levels_flat_start[level_current - 1])) > 1) {
-		for (idx_t pos = 0; pos < level_size; pos += TREE_FANOUT) {
-			// compute the aggregate for this entry in the segment tree
-			data_ptr_t state_ptr = levels_flat_native.get() + (levels_flat_offset * state_size);
-			aggr.function.initialize(state_ptr);
-			gtstate.WindowSegmentValue(*this, level_current, pos, MinValue(level_size, pos + TREE_FANOUT), state_ptr);
-			gtstate.FlushStates(level_current > 0);
-
-			levels_flat_offset++;
+	if (inputs.size() > TASK_ROWS) {
+		D_ASSERT(levels_flat_start.size() > TASK_LEVELS + 1);
+		{
+			lock_guard<mutex> tasks_guard(tasks_lock);
+			tasks_total = (inputs.size() + TASK_ROWS - 1) / TASK_ROWS;
+		}
+		while (ConstructTreeTask()) {
 		}
+		//	Wait for the tasks that other threads are still running
+		while (tasks_completed < tasks_total) {
+			TaskScheduler::YieldThread();
+		}
+		//	A task that failed did not compute its nodes
+		if (task_error.HasError()) {
+			task_error.Throw();
+		}
+		level_current = TASK_LEVELS;
+	}
 
-		levels_flat_start.push_back(levels_flat_offset);
-		level_current++;
+	// iterate over the remaining levels of the segment tree
+	for (; level_current + 1 < levels_flat_start.size(); level_current++) {
+		const auto level_nodes = levels_flat_start[level_current + 1] - levels_flat_start[level_current];
+		ConstructLevel(gtstate, level_current, 0, level_nodes);
 	}
 
 	// Corner case: single element in the window
-	if (levels_flat_offset == 0) {
+	if (levels_flat_start.size() == 1) {
 		aggr.function.initialize(levels_flat_native.get());
 	}
 }
 
+void WindowSegmentTree::ConstructLevel(WindowSegmentTreePart &part, idx_t level, idx_t begin, idx_t end) {
+	const auto level_size = level == 0 ? inputs.size() : levels_flat_start[level] - levels_flat_start[level - 1];
+	for (idx_t node = begin; node < end; node++) {
+		// compute the aggregate for this entry in the segment tree
+		data_ptr_t state_ptr = levels_flat_native.get() + ((levels_flat_start[level] + node) * state_size);
+		aggr.function.initialize(state_ptr);
+		const auto pos = node * TREE_FANOUT;
+		part.WindowSegmentValue(*this, level, pos, MinValue(level_size, pos + TREE_FANOUT), state_ptr);
+		part.FlushStates(level > 0);
+	}
+}
+
+//! Marks a construction task as completed when it goes out of scope, also if it throws
+struct WindowTreeTaskGuard {
+	explicit WindowTreeTaskGuard(atomic<idx_t> &tasks_completed_p) : tasks_completed(tasks_completed_p) {
+	}
+	~WindowTreeTaskGuard() {
+		++tasks_completed;
+	}
+
+	atomic<idx_t> &tasks_completed;
+};
+
+bool WindowSegmentTree::ConstructTreeTask() {
+	idx_t task_idx;
+	optional_ptr<ArenaAllocator> allocator;
+	{
+		lock_guard<mutex> tasks_guard(tasks_lock);
+		if (tasks_claimed >= tasks_total) {
+			return false;
+		}
+		task_idx = tasks_claimed++;
+		task_allocators.emplace_back(make_uniq<ArenaAllocator>(Allocator::DefaultAllocator()));
+		allocator = task_allocators.back().get();
+	}
+
+	//	The owner of the tree waits until every task is completed
+	WindowTreeTaskGuard task_guard(tasks_completed);
+	try {
+		//	The nodes of the lower levels only depend on the rows of the task
+		WindowSegmentTreePart part(*allocator, aggr, inputs, filter_mask);
+		idx_t rows_per_node = 1;
+		for (idx_t level = 0; level < TASK_LEVELS; level++) {
+			rows_per_node *= TREE_FANOUT;
+			const auto level_nodes = levels_flat_start[level + 1] - levels_flat_start[level];
+			const auto begin = task_idx * TASK_ROWS / rows_per_node;
+			const auto end = MinValue((task_idx + 1) * TASK_ROWS / rows_per_node, level_nodes);
+			ConstructLevel(part, level, begin, end);
+		}
+	} catch (std::exception &ex) {
+		lock_guard<mutex> tasks_guard(tasks_lock);
+		task_error = ErrorData(ex);
+		throw;
+	}
+	return true;
+}
+
+bool WindowSegmentTree::AssistFinalize() {
+	return ConstructTreeTask();
+}
+
 void WindowSegmentTree::Evaluate(WindowAggregatorState &lstate, const DataChunk &bounds, Vector &result, idx_t count,
                                  idx_t row_idx) const {
 
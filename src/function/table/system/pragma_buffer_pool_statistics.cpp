@@ -0,0 +1,97 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/buffer/buffer_pool.hpp"
+
+namespace duckdb {
+
+struct PragmaBufferPoolStatisticsData : public GlobalTableFunctionState {
+	PragmaBufferPoolStatisticsData() : offset(0) {
+	}
+
+	vector<BufferPoolStatistics> entries;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> PragmaBufferPoolStatisticsBind(ClientContext &context, TableFunctionBindInput &input,
+                                                               vector<LogicalType> &return_types,
+                                                               vector<string> &names) {
+	names.emplace_back("tag");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("hits");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("misses");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("hit_rate");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	names.emplace_back("second_chances");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("allocation_evictions");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("memory_limit_evictions");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("age_evictions");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> PragmaBufferPoolStatisticsInit(ClientContext &context,
+                                                                    TableFunctionInitInput &input) {
+	auto result = make_uniq<PragmaBufferPoolStatisticsData>();
+
+	result->entries = BufferManager::GetBufferManager(context).GetBufferPool().GetStatistics();
+	return std::move(result);
+}
+
+static Value EvictionCount(const BufferPoolStatistics &entry, EvictionCause cause) {
+	return Value::BIGINT(NumericCast<int64_t>(entry.evictions[static_cast<uint8_t>(cause)]));
+}
+
+void PragmaBufferPoolStatisticsFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<PragmaBufferPoolStatisticsData>();
+	if (data.offset >= data.entries.size()) {
+		// finished returning values
+		return;
+	}
+	// start returning values
+	// either fill up the chunk or return all the remaining columns
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = data.entries[data.offset++];
+		// return values:
+		idx_t col = 0;
+		// tag, VARCHAR
+		output.SetValue(col++, count, EnumUtil::ToString(entry.tag));
+		// hits, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.hits)));
+		// misses, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.misses)));
+		// hit_rate, DOUBLE
+		auto pins = entry.hits + entry.misses;
+		output.SetValue(col++, count, pins == 0 ? Value() : Value::DOUBLE(double(entry.hits) / double(pins)));
+		// second_chances, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.second_chances)));
+		// allocation_evictions, BIGINT
+		output.SetValue(col++, count, EvictionCount(entry, EvictionCause::ALLOCATION));
+		// memory_limit_evictions, BIGINT
+		output.SetValue(col++, count, EvictionCount(entry, EvictionCause::MEMORY_LIMIT));
+		// age_evictions, BIGINT
+		output.SetValue(col++, count, EvictionCount(entry, EvictionCause::AGE));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void PragmaBufferPoolStatistics::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("pragma_buffer_pool_statistics", {}, PragmaBufferPoolStatisticsFunction,
+	                              PragmaBufferPoolStatisticsBind, PragmaBufferPoolStatisticsInit));
+}
+
+} // namespace duckdb
@@ -259,6 +259,147 @@ static void IndexScanFunction(ClientContext &context, TableFunctionInput &data_p
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// Index Order Scan
+//===--------------------------------------------------------------------===//
+struct IndexOrderScanGlobalState : public GlobalTableFunctionState {
+	//! The visible row ids with the smallest (or largest) keys, in key order
+	vector<row_t> row_ids;
+	idx_t offset = 0;
+	ColumnFetchState fetch_state;
+	TableScanState local_storage_state;
+	vector<storage_t> column_ids;
+	//! Whether or not the index could not produce the rows: we scan the full table instead
+	bool full_scan = false;
+	TableScanState table_scan_state;
+};
+
+static optional_ptr<ART> FindOrderIndex(ClientContext &context, DuckTableEntry &table, column_t column_id) {
+	auto &storage = table.GetStorage();
+	auto &info = storage.GetDataTableInfo();
+	optional_ptr<ART> result;
+	info->GetIndexes().BindAndScan<ART>(context, *info, [&](ART &art_index) {
+		// NOTE: only indexes on a single plain column contain the keys in the order of the column
+		auto &column_ids = art_index.GetColumnIds();
+		if (art_index.unbound_expressions.size() != 1 || column_ids.size() != 1 ||
+		    art_index.unbound_expressions[0]->type != ExpressionType::BOUND_COLUMN_REF) {
+			return false;
+		}
+		if (column_ids[0] != column_id) {
+			return false;
+		}
+		result = &art_index;
+		return true;
+	});
+	return result;
+}
+
+bool TableScanFunction::HasOrderIndex(ClientContext &context, DuckTableEntry &table, column_t column_id) {
+	auto checkpoint_lock = table.GetStorage().GetSharedCheckpointLock();
+	return FindOrderIndex(context, table, column_id) != nullptr;
+}
+
+//! Appends the row ids that are visible to the transaction to the result, in the order of the input
+static void AppendVisibleRowIds(DuckTransaction &transaction, DataTable &storage, const vector<row_t> &row_ids,
+                                vector<row_t> &result) {
+	vector<column_t> fetch_ids {COLUMN_IDENTIFIER_ROW_ID};
+	DataChunk chunk;
+	chunk.Initialize(Allocator::DefaultAllocator(), {LogicalType::ROW_TYPE});
+	ColumnFetchState fetch_state;
+	for (idx_t offset = 0; offset < row_ids.size(); offset += STANDARD_VECTOR_SIZE) {
+		auto count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, row_ids.size() - offset);
+		Vector row_id_vector(LogicalType::ROW_TYPE, data_ptr_cast(const_cast<row_t *>(row_ids.data() + offset)));
+		chunk.Reset();
+		storage.Fetch(transaction, chunk, fetch_ids, row_id_vector, count, fetch_state);
+		auto data = FlatVector::GetData<row_t>(chunk.data[0]);
+		result.insert(result.end(), data, data + chunk.size());
+	}
+}
+
+static unique_ptr<GlobalTableFunctionState> IndexOrderScanInitGlobal(ClientContext &context,
+                                                                     TableFunctionInitInput &input) {
+	auto &bind_data = input.bind_data->Cast<TableScanBindData>();
+	auto &storage = bind_data.table.GetStorage();
+	auto &transaction = DuckTransaction::Get(context, bind_data.table.catalog);
+	auto result = make_uniq<IndexOrderScanGlobalState>();
+
+	result->column_ids.reserve(input.column_ids.size());
+	for (auto &id : input.column_ids) {
+		result->column_ids.push_back(GetStorageIndex(bind_data.table, id));
+	}
+
+	// fetch the row ids of the smallest (or largest) keys from the index, until enough of them are visible
+	bool found_rows = false;
+	auto max_count = MaxValue<idx_t>(bind_data.order_row_count * 2, STANDARD_VECTOR_SIZE);
+	// rows that were deleted after the transaction started are still visible to it, but can be missing from the index
+	auto index_complete = storage.GetDataTableInfo()->IndexesContainVisibleRows(transaction.start_time);
+	while (index_complete) {
+		vector<row_t> row_ids;
+		bool exhausted;
+		{
+			auto checkpoint_lock = storage.GetSharedCheckpointLock();
+			auto art = FindOrderIndex(context, bind_data.table, bind_data.order_column);
+			if (!art) {
+				break;
+			}
+			exhausted = art->ScanOrdered(bind_data.order_descending, max_count, row_ids);
+		}
+		// an index cleanup can have started while we read the index (it is registered before the rows are removed)
+		if (!storage.GetDataTableInfo()->IndexesContainVisibleRows(transaction.start_time)) {
+			break;
+		}
+		result->row_ids.clear();
+		AppendVisibleRowIds(transaction, storage, row_ids, result->row_ids);
+		if (result->row_ids.size() >= bind_data.order_row_count) {
+			found_rows = true;
+			break;
+		}
+		if (exhausted) {
+			// NULL values are not in the index, but can still be part of the result
+			break;
+		}
+		max_count *= 4;
+	}
+
+	if (!found_rows) {
+		result->full_scan = true;
+		result->row_ids.clear();
+		result->table_scan_state.options.force_fetch_row = ClientConfig::GetConfig(context).force_fetch_row;
+		storage.InitializeScan(transaction, result->table_scan_state, result->column_ids, input.filters.get());
+		return std::move(result);
+	}
+
+	auto &local_storage = LocalStorage::Get(context, bind_data.table.catalog);
+	result->local_storage_state.options.force_fetch_row = ClientConfig::GetConfig(context).force_fetch_row;
+	result->local_storage_state.Initialize(result->column_ids, input.filters.get());
+	local_storage.InitializeScan(storage, result->local_storage_state.local_state, input.filters);
+	return std::move(result);
+}
+
+static void IndexOrderScanFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &bind_data = data_p.bind_data->Cast<TableScanBindData>();
+	auto &state = data_p.global_state->Cast<IndexOrderScanGlobalState>();
+	auto &transaction = DuckTransaction::Get(context, bind_data.table.catalog);
+	auto &storage = bind_data.table.GetStorage();
+
+	if (state.full_scan) {
+		storage.Scan(transaction, output, state.table_scan_state);
+		return;
+	}
+	if (state.offset < state.row_ids.size()) {
+		auto count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, state.row_ids.size() - state.offset);
+		Vector row_ids(LogicalType::ROW_TYPE, data_ptr_cast(state.row_ids.data() + state.offset));
+		storage.Fetch(transaction, output, state.column_ids, row_ids, count, state.fetch_state);
+		state.offset += count;
+		// the row ids are visible to this transaction, so all of them are fetched
+		D_ASSERT(output.size() == count);
+		return;
+	}
+	// the rows of the transaction-local storage are not in the index
+	auto &local_storage = LocalStorage::Get(transaction);
+	local_storage.Scan(state.local_storage_state.local_state, state.column_ids, output);
+}
+
 static void RewriteIndexExpression(Index &index, LogicalGet &get, Expression &expr, bool &rewrite_possible) {
 	if (expr.type == ExpressionType::BOUND_COLUMN_REF) {
 		auto &bound_colref = expr.Cast<BoundColumnRefExpression>();
@@ -361,6 +502,10 @@ static void TableScanSerialize(Serializer &serializer, const optional_ptr<Functi
 	serializer.WriteProperty(103, "is_index_scan", bind_data.is_index_scan);
 	serializer.WriteProperty(104, "is_create_index", bind_data.is_create_index);
 	serializer.WriteProperty(105, "result_ids", bind_data.result_ids);
+	serializer.WritePropertyWithDefault<column_t>(106, "order_column", bind_data.order_column,
+	                                              column_t(DConstants::INVALID_INDEX));
+	serializer.WritePropertyWithDefault<bool>(107, "order_descending", bind_data.order_descending, false);
+	serializer.WritePropertyWithDefault<idx_t>(108, "order_row_count", bind_data.order_row_count, 0);
 }
 
 static unique_ptr<FunctionData> TableScanDeserialize(Deserializer &deserializer, TableFunction &function) {
@@ -376,6 +521,10 @@ static unique_ptr<FunctionData> TableScanDeserialize(Deserializer &deserializer,
 	deserializer.ReadProperty(103, "is_index_scan", result->is_index_scan);
 	deserializer.ReadProperty(104, "is_create_index", result->is_create_index);
 	deserializer.ReadProperty(105, "result_ids", result->result_ids);
+	deserializer.ReadPropertyWithDefault<column_t>(106, "order_column", result->order_column,
+	                                               column_t(DConstants::INVALID_INDEX));
+	deserializer.ReadPropertyWithDefault<bool>(107, "order_descending", result->order_descending, false);
+	deserializer.ReadPropertyWithDefault<idx_t>(108, "order_row_count", result->order_row_count, 0);
 	return std::move(result);
 }
 
@@ -398,6 +547,25 @@ TableFunction TableScanFunction::GetIndexScanFunction() {
 	return scan_function;
 }
 
+TableFunction TableScanFunction::GetIndexOrderScanFunction() {
+	TableFunction scan_function("index_order_scan", {}, IndexOrderScanFunction);
+	scan_function.init_local = nullptr;
+	scan_function.init_global = IndexOrderScanInitGlobal;
+	scan_function.statistics = TableScanStatistics;
+	scan_function.dependency = TableScanDependency;
+	scan_function.cardinality = TableScanCardinality;
+	scan_function.pushdown_complex_filter = nullptr;
+	scan_function.to_string = TableScanToString;
+	scan_function.table_scan_progress = nullptr;
+	scan_function.get_batch_index = nullptr;
+	scan_function.projection_pushdown = true;
+	scan_function.filter_pushdown = false;
+	scan_function.get_bind_info = TableScanGetBindInfo;
+	scan_function.serialize = TableScanSerialize;
+	scan_function.deserialize = TableScanDeserialize;
+	return scan_function;
+}
+
 TableFunction TableScanFunction::GetFunction() {
 	TableFunction scan_function("seq_scan", {}, TableScanFunc);
 	scan_function.init_local = TableScanInitLocal;
@@ -413,6 +581,7 @@ TableFunction TableScanFunction::GetFunction() {
 	scan_function.projection_pushdown = true;
 	scan_function.filter_pushdown = true;
 	scan_function.filter_prune = true;
+	scan_function.dynamic_filter_pushdown = true;
 	scan_function.serialize = TableScanSerialize;
 	scan_function.deserialize = TableScanDeserialize;
 	return scan_function;
@@ -424,6 +593,7 @@ void TableScanFunction::RegisterFunction(BuiltinFunctions &set) {
 	set.AddFunction(std::move(table_scan_set));
 
 	set.AddFunction(GetIndexScanFunction());
+	set.AddFunction(GetIndexOrderScanFunction());
 }
 
 void BuiltinFunctions::RegisterTableScanFunctions() {
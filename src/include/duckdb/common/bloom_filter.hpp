@@ -0,0 +1,68 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/types/vector.hpp"
+
+namespace duckdb {
+
+//! BloomFilter is a register-blocked Bloom filter over hashes. Every hash sets BITS_PER_HASH bits within a single
+//! 64-bit block, so inserting or probing a hash touches exactly one cache line. Inserting is thread-safe.
+class BloomFilter {
+public:
+	//! The number of bits that are reserved per expected entry (before rounding up to a power of two)
+	static constexpr const idx_t BITS_PER_ENTRY = 8;
+	//! The number of bits that are set within a block for every hash
+	static constexpr const idx_t BITS_PER_HASH = 4;
+
+public:
+	explicit BloomFilter(idx_t expected_count);
+
+	//! Inserts "count" hashes
+	void Insert(Vector &hashes, idx_t count);
+	//! Inserts "count" hashes
+	void Insert(const hash_t *hashes, idx_t count);
+	//! Filters the "count" entries in "sel" (which index into "hashes"), keeping only the entries whose hash may have
+	//! been inserted. Returns the number of remaining entries
+	idx_t Filter(Vector &hashes, SelectionVector &sel, idx_t count) const;
+	//! Writes the entries of the "count" entries in "sel" (which index into "hashes") whose hash may have been inserted
+	//! to "result", which may be the same as "sel". Returns the number of entries in "result"
+	idx_t Filter(Vector &hashes, const SelectionVector &sel, idx_t count, SelectionVector &result) const;
+
+	//! Whether or not the hash may have been inserted
+	inline bool Lookup(hash_t hash) const {
+		const auto mask = GetMask(hash);
+		return (blocks[GetBlockIndex(hash)].load(std::memory_order_relaxed) & mask) == mask;
+	}
+
+	idx_t SizeInBytes() const {
+		return block_count * sizeof(uint64_t);
+	}
+
+private:
+	inline idx_t GetBlockIndex(hash_t hash) const {
+		// the lower bits are used to select the bits within the block
+		return (hash >> 32) & (block_count - 1);
+	}
+
+	static inline uint64_t GetMask(hash_t hash) {
+		return (uint64_t(1) << (hash & 63)) | (uint64_t(1) << ((hash >> 6) & 63)) |
+		       (uint64_t(1) << ((hash >> 12) & 63)) | (uint64_t(1) << ((hash >> 18) & 63));
+	}
+
+private:
+	//! The number of 64-bit blocks (always a power of two)
+	idx_t block_count;
+	//! The blocks
+	unsafe_unique_array<atomic<uint64_t>> blocks;
+};
+
+} // namespace duckdb
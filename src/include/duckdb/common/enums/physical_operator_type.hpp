@@ -49,6 +49,7 @@ enum class PhysicalOperatorType : uint8_t {
 	DELIM_SCAN,
 	EXPRESSION_SCAN,
 	POSITIONAL_SCAN,
+	TABLE_FETCH,
 	// -----------------------------
 	// Joins
 	// -----------------------------
@@ -62,6 +63,7 @@ enum class PhysicalOperatorType : uint8_t {
 	RIGHT_DELIM_JOIN,
 	POSITIONAL_JOIN,
 	ASOF_JOIN,
+	INDEX_JOIN,
 	// -----------------------------
 	// SetOps
 	// -----------------------------
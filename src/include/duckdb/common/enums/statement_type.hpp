@@ -63,7 +63,8 @@ string StatementReturnTypeToString(StatementReturnType type);
 struct StatementProperties {
 	StatementProperties()
 	    : requires_valid_transaction(true), allow_stream_result(false), bound_all_parameters(true),
-	      return_type(StatementReturnType::QUERY_RESULT), parameter_count(0), always_require_rebind(false) {
+	      return_type(StatementReturnType::QUERY_RESULT), parameter_count(0), always_require_rebind(false),
+	      only_appends(false) {
 	}
 
 	//! The set of databases this statement will read from
@@ -83,6 +84,9 @@ struct StatementProperties {
 	idx_t parameter_count;
 	//! Whether or not the statement ALWAYS requires a rebind
 	bool always_require_rebind;
+	//! Whether or not the statement only appends rows to the tables it modifies, i.e., it does not change existing
+	//! rows or catalog entries
+	bool only_appends;
 
 	bool IsReadOnly() {
 		return modified_databases.empty();
@@ -51,6 +51,8 @@ enum class WALType : uint8_t {
 	INSERT_TUPLE = 26,
 	DELETE_TUPLE = 27,
 	UPDATE_TUPLE = 28,
+	//! An INSERT_TUPLE whose chunk is compressed
+	COMPRESSED_INSERT_TUPLE = 29,
 	// -----------------------------
 	// Flush
 	// -----------------------------
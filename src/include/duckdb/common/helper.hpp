@@ -208,6 +208,15 @@ void Store(const T &val, data_ptr_t ptr) {
 	memcpy(ptr, (void *)&val, sizeof(val)); // NOLINT
 }
 
+//! Hints the CPU to load the cache line containing the address, ahead of a (dependent) access to it
+static inline void PrefetchMemory(const void *address) {
+#if defined(__GNUC__) || defined(__clang__)
+	__builtin_prefetch(address);
+#else
+	(void)address;
+#endif
+}
+
 //! This assigns a shared pointer, but ONLY assigns if "target" is not equal to "source"
 //! If this is often the case, this manner of assignment is significantly faster (~20X faster)
 //! Since it avoids the need of an atomic incref/decref at the cost of a single pointer comparison
@@ -22,6 +22,8 @@ struct SortConstants {
 	static constexpr idx_t MSD_RADIX_LOCATIONS = VALUES_PER_RADIX + 1;
 	static constexpr idx_t INSERTION_SORT_THRESHOLD = 24;
 	static constexpr idx_t MSD_RADIX_SORT_SIZE_THRESHOLD = 4;
+	//! Maximum number of sorted blocks that are merged at once during an external sort
+	static constexpr idx_t MAX_MERGE_FAN_IN = 16;
 };
 
 struct SortLayout {
@@ -67,6 +69,10 @@ public:
 	//! Print the sorted data to the console.
 	void Print();
 
+private:
+	//! Computes how many sorted blocks a single merge task should merge in the next round
+	idx_t ComputeMergeFanIn() const;
+
 public:
 	//! The lock for updating the order global state
 	mutex lock;
@@ -91,6 +97,9 @@ public:
 	//! Whether we are doing an external sort
 	bool external;
 
+	//! Number of sorted blocks that are merged by a single task in this round
+	//! Pairs are merged in parallel using Merge Path, more than two blocks are merged with a loser tree
+	idx_t merge_fan_in;
 	//! Progress in merge path stage
 	idx_t pair_idx;
 	idx_t num_pairs;
@@ -170,6 +179,12 @@ private:
 	unique_ptr<SortedBlock> right_input;
 	SortedBlock *result;
 
+	//! The sorted blocks, readers, and loser tree of a k-way merge
+	vector<unique_ptr<SortedBlock>> run_inputs;
+	vector<unique_ptr<SBScanState>> runs;
+	vector<idx_t> loser_tree;
+	unique_ptr<SBScanState> writer;
+
 private:
 	//! Computes the left and right block that will be merged next (Merge Path partition)
 	void GetNextPartition();
@@ -184,6 +199,21 @@ private:
 	//! Computes how the next 'count' tuples should be merged by setting the 'left_smaller' array
 	void ComputeMerge(const idx_t &count, bool left_smaller[]);
 
+	//! Claims the next group of sorted blocks that will be merged by a k-way merge
+	void GetNextGroup();
+	//! Merges the claimed group of sorted blocks into a single sorted block using a loser tree
+	void MergeGroup();
+	//! Whether the current entry of run 'l' comes before the current entry of run 'r' (exhausted runs come last)
+	bool RunIsSmaller(idx_t l, idx_t r);
+	//! Replays the matches on the path from the leaf of a run to the root of the loser tree
+	void AdjustLoserTree(idx_t run_idx);
+	//! Pins the current entry of a run, moving to the next block (if needed)
+	void PinRun(idx_t run_idx);
+	//! Copies the current entry of a run to the result, and advances the run
+	void PopRun(idx_t run_idx);
+	//! Copies the current row (and heap row, if needed) of a run to the result
+	void CopyRunRow(SBScanState &run, SortedData &source_data, SortedData &result_data);
+
 	//! Merges the radix sorting blocks according to the 'left_smaller' array
 	void MergeRadix(const idx_t &count, const bool left_smaller[]);
 	//! Merges SortedData according to the 'left_smaller' array
@@ -90,6 +90,9 @@ public:
 public:
 	//! The hash table load factor, when a resize is triggered
 	constexpr static double LOAD_FACTOR = 1.5;
+	//! If the pointer table is larger than this (in bytes), it no longer fits in the cache, and we prefetch the
+	//! entries (and the rows they point to) of a vector before probing them
+	constexpr static idx_t PREFETCH_THRESHOLD = 524288;
 
 	//! Get the layout of this HT
 	const TupleDataLayout &GetLayout() const;
@@ -131,6 +134,9 @@ public:
 	void ClearPointerTable();
 	//! Resets the group count to 0
 	void ResetCount();
+	//! Whether or not to skip the lookups in the pointer table: every row is appended as a new group
+	void SetSkipLookups(bool skip_lookups);
+	bool SkipLookups() const;
 	//! Set the radix bits for this HT
 	void SetRadixBits(idx_t radix_bits);
 	//! Initializes the PartitionedTupleData
@@ -174,6 +180,8 @@ private:
 
 	//! The number of groups in the HT
 	idx_t count;
+	//! Whether rows are appended as new groups without looking them up (pre-aggregation is bypassed)
+	bool skip_lookups;
 	//! The capacity of the HT. This can be increased using GroupedAggregateHashTable::Resize
 	idx_t capacity;
 	//! The hash map (pointer table) of the HT: allocated data and pointer into it
@@ -61,6 +61,9 @@ public:
 	//! and false otherwise
 	bool Scan(const Transaction &transaction, const DataTable &table, IndexScanState &state, idx_t max_count,
 	          vector<row_t> &result_ids);
+	//! Fetches the row IDs of the smallest (or largest, if descending) keys in key order, until at least max_count
+	//! row IDs are fetched. Returns true if all row IDs of the index were fetched, and false otherwise
+	bool ScanOrdered(const bool descending, const idx_t max_count, vector<row_t> &result_ids);
 
 public:
 	//! Create a index instance of this type
@@ -83,13 +86,15 @@ public:
 	//! Insert a chunk of entries into the index
 	ErrorData Insert(IndexLock &lock, DataChunk &data, Vector &row_ids) override;
 
-	//! Construct an ART from a vector of sorted keys
-	bool ConstructFromSorted(idx_t count, vector<ARTKey> &keys, Vector &row_identifiers);
+	//! Construct an (empty) ART bottom-up from the first "count" keys of a vector of sorted keys and their row IDs
+	bool ConstructFromSorted(idx_t count, vector<ARTKey> &keys, const row_t *row_ids);
 
 	//! Search equal values and fetches the row IDs
 	bool SearchEqual(ARTKey &key, idx_t max_count, vector<row_t> &result_ids);
-	//! Search equal values used for joins that do not need to fetch data
-	void SearchEqualJoinNoFetch(ARTKey &key, idx_t &result_size);
+	//! Search the row IDs of the first "count" keys for an index join, and append them to "result_ids". For each row
+	//! ID, the index of its key is appended to "key_indexes". Empty (NULL) keys have no matches. Obtains the index lock
+	void SearchEqualJoin(const vector<ARTKey> &keys, idx_t count, vector<row_t> &result_ids,
+	                     vector<idx_t> &key_indexes);
 
 	//! Returns all ART storage information for serialization
 	IndexStorageInfo GetStorageInfo(const bool get_buffers) override;
@@ -119,6 +124,9 @@ public:
 
 	//! Find the node with a matching key, or return nullptr if not found
 	optional_ptr<const Node> Lookup(const Node &node, const ARTKey &key, idx_t depth);
+	//! Find the nodes with matching keys for the first "count" keys, and set their entries in "leaves" (nullptr, if
+	//! not found or if the key is empty). Interleaves the traversals of several keys and prefetches their next nodes
+	void Lookup(const vector<ARTKey> &keys, idx_t count, vector<optional_ptr<const Node>> &leaves);
 	//! Insert a key into the tree
 	bool Insert(Node &node, const ARTKey &key, idx_t depth, const row_t &row_id);
 
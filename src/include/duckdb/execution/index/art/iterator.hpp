@@ -61,8 +61,13 @@ public:
 	//! Scans the tree, starting at the current top node on the stack, and ending at upper_bound.
 	//! If upper_bound is the empty ARTKey, than there is no upper bound
 	bool Scan(const ARTKey &upper_bound, const idx_t max_count, vector<row_t> &result_ids, const bool equal);
+	//! Scans the tree in key order (or in reverse key order), starting at the current leaf. Stops after the first leaf
+	//! that reaches max_count row IDs. Returns true, if there are no more leaves to scan
+	bool ScanOrdered(const idx_t max_count, vector<row_t> &result_ids, const bool descending);
 	//! Finds the minimum (leaf) of the current subtree
 	void FindMinimum(const Node &node);
+	//! Finds the maximum (leaf) of the current subtree
+	void FindMaximum(const Node &node);
 	//! Finds the lower bound of the ART and adds the nodes to the stack. Returns false, if the lower
 	//! bound exceeds the maximum value of the ART
 	bool LowerBound(const Node &node, const ARTKey &key, const bool equal, idx_t depth);
@@ -76,6 +81,9 @@ private:
 	//! Goes to the next leaf in the ART and sets it as last_leaf,
 	//! returns false if there is no next leaf
 	bool Next();
+	//! Goes to the previous leaf in the ART and sets it as last_leaf,
+	//! returns false if there is no previous leaf
+	bool Prev();
 	//! Pop the top node from the stack of iterator entries and adjust the current key
 	void PopNode();
 };
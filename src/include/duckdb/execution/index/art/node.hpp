@@ -87,10 +87,14 @@ public:
 	optional_ptr<const Node> GetChild(ART &art, const uint8_t byte) const;
 	//! Get the child for the respective byte in the node
 	optional_ptr<Node> GetChildMutable(ART &art, const uint8_t byte) const;
+	//! Prefetch the memory that is accessed when traversing the node, i.e., the memory of the child at byte
+	void Prefetch(ART &art, const uint8_t byte) const;
 	//! Get the first child (immutable) that is greater or equal to the specific byte
 	optional_ptr<const Node> GetNextChild(ART &art, uint8_t &byte) const;
 	//! Get the first child that is greater or equal to the specific byte
 	optional_ptr<Node> GetNextChildMutable(ART &art, uint8_t &byte) const;
+	//! Get the last child (immutable) that is less or equal to the specific byte
+	optional_ptr<const Node> GetPrevChild(ART &art, uint8_t &byte) const;
 
 	//! Returns the string representation of the node, or only traverses and verifies the node and its subtree
 	string VerifyAndToString(ART &art, const bool only_verify) const;
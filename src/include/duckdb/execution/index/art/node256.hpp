@@ -56,6 +56,8 @@ public:
 	optional_ptr<const Node> GetNextChild(uint8_t &byte) const;
 	//! Get the first child that is greater or equal to the specific byte
 	optional_ptr<Node> GetNextChildMutable(uint8_t &byte);
+	//! Get the last (immutable) child that is less or equal to the specific byte
+	optional_ptr<const Node> GetPrevChild(uint8_t &byte) const;
 
 	//! Vacuum the children of the node
 	void Vacuum(ART &art, const ARTFlags &flags);
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/bloom_filter.hpp"
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/radix_partitioning.hpp"
 #include "duckdb/common/types/column/column_data_consumer.hpp"
@@ -190,6 +191,17 @@ public:
 	bool has_null;
 	//! Bitmask for getting relevant bits from the hashes to determine the position
 	uint64_t bitmask;
+	//! Bloom filter over the hashes of the keys (if any), filled during Finalize
+	shared_ptr<BloomFilter> bloom_filter;
+	//! Whether or not the probe side keys are checked against the Bloom filter before probing the HT
+	atomic<bool> bloom_filter_probe;
+	//! The number of probe side keys that were checked against the Bloom filter, and how many of those passed
+	atomic<idx_t> bloom_filter_probe_count;
+	atomic<idx_t> bloom_filter_pass_count;
+	//! The Bloom filter is no longer checked if more than this fraction of the probe side keys pass it
+	static constexpr const double BLOOM_FILTER_MAX_PASS_RATE = 0.5;
+	//! After how many probe side keys we decide whether or not to keep checking the Bloom filter
+	static constexpr const idx_t BLOOM_FILTER_SAMPLE_COUNT = 16 * STANDARD_VECTOR_SIZE;
 
 	struct {
 		mutex mj_lock;
@@ -212,6 +224,8 @@ private:
 	unique_ptr<ScanStructure> InitializeScanStructure(DataChunk &keys, TupleDataChunkState &key_state,
 	                                                  const SelectionVector *&current_sel);
 	void Hash(DataChunk &keys, const SelectionVector &sel, idx_t count, Vector &hashes);
+	//! Checks the "count" keys in "sel" against the Bloom filter, writing the keys that pass to "result"
+	idx_t ProbeBloomFilter(Vector &hashes, const SelectionVector &sel, idx_t count, SelectionVector &result);
 
 	//! Apply a bitmask to the hashes
 	void ApplyBitmask(Vector &hashes, idx_t count);
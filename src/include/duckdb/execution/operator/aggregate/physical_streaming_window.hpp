@@ -13,12 +13,20 @@
 
 namespace duckdb {
 
+class BoundWindowExpression;
+
 //! PhysicalStreamingWindow implements streaming window functions (i.e. with an empty OVER clause)
 class PhysicalStreamingWindow : public PhysicalOperator {
 public:
 	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::STREAMING_WINDOW;
 
-	static bool IsStreamingFunction(unique_ptr<Expression> &expr);
+	static bool IsStreamingFunction(ClientContext &context, unique_ptr<Expression> &expr);
+	//! Returns the number of rows in a ROWS BETWEEN <constant> PRECEDING AND CURRENT ROW frame,
+	//! or DConstants::INVALID_INDEX if the frame can not be streamed
+	static idx_t GetSlidingFrameSize(ClientContext &context, BoundWindowExpression &wexpr);
+
+	//! The maximum number of rows in a sliding frame that is streamed, which must be buffered
+	static constexpr idx_t MAX_SLIDING_FRAME_SIZE = 65536;
 
 public:
 	PhysicalStreamingWindow(vector<LogicalType> types, vector<unique_ptr<Expression>> select_list,
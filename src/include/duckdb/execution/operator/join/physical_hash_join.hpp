@@ -17,6 +17,16 @@
 
 namespace duckdb {
 
+struct DynamicFilterData;
+
+//! A filter over the build side keys of a join condition that is pushed into the table scan on the probe side
+struct JoinFilterPushdownColumn {
+	//! The index of the join condition
+	idx_t condition_idx;
+	//! The state of the dynamic filter in the probe side table scan
+	shared_ptr<DynamicFilterData> filter_data;
+};
+
 //! PhysicalHashJoin represents a hash loop join between two tables
 class PhysicalHashJoin : public PhysicalComparisonJoin {
 public:
@@ -51,10 +61,22 @@ public:
 	vector<LogicalType> delim_types;
 	//! Used in perfect hash join
 	PerfectHashJoinStats perfect_join_statistics;
+	//! Filters over the build side keys that are set in the probe side table scans once the build is done
+	vector<JoinFilterPushdownColumn> filter_pushdown;
+	//! Whether or not the probe side keys are checked against a Bloom filter over the build side keys before probing
+	//! the hash table, which pays off if most probe side keys do not have a match
+	bool bloom_filter_probe = false;
+	//! Up to how many build side keys we create a Bloom filter (4MB)
+	static constexpr const idx_t JOIN_FILTER_BLOOM_THRESHOLD = 4194304;
 
 public:
 	string ParamsToString() const override;
 
+	//! Whether or not rows on the probe side without a match can be filtered out before the join
+	bool CanPushDownJoinFilters() const;
+	//! Whether or not the min/max of build side keys of this type can be pushed down as a range filter
+	static bool CanPushDownRangeFilter(const LogicalType &type);
+
 public:
 	// Operator Interface
 	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context) const override;
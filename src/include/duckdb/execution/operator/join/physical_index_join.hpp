@@ -0,0 +1,68 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/join/physical_index_join.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/planner/expression.hpp"
+#include "duckdb/planner/table_filter.hpp"
+
+namespace duckdb {
+class ART;
+class DuckTableEntry;
+
+//! PhysicalIndexJoin is an inner equality join that looks up the join keys of its input (the outer side) in the ART
+//! index on the join column of a base table (the inner side), and fetches the matching rows by their row ids. It is
+//! used instead of a hash join if the outer side is much smaller than the table, so the table is never scanned
+class PhysicalIndexJoin : public PhysicalOperator {
+public:
+	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::INDEX_JOIN;
+
+public:
+	PhysicalIndexJoin(vector<LogicalType> types, unique_ptr<PhysicalOperator> outer, unique_ptr<Expression> outer_key,
+	                  vector<idx_t> outer_projection_map, DuckTableEntry &table, ART &index,
+	                  vector<column_t> fetch_ids, vector<LogicalType> fetch_types,
+	                  unique_ptr<TableFilterSet> table_filters, unique_ptr<Expression> filter_expression,
+	                  bool inner_is_left, idx_t estimated_cardinality);
+
+	//! The join key, evaluated on the outer side
+	unique_ptr<Expression> outer_key;
+	//! The columns of the outer side that are emitted
+	vector<idx_t> outer_projection_map;
+	//! The table of the inner side
+	DuckTableEntry &table;
+	//! The index on the join column of the table
+	ART &index;
+	//! The storage indexes of the columns of the table that are fetched (or COLUMN_IDENTIFIER_ROW_ID), the emitted
+	//! columns first, followed by the columns that are only filtered on
+	vector<column_t> fetch_ids;
+	//! The types of the columns of the table that are fetched
+	vector<LogicalType> fetch_types;
+	//! The number of columns of the table that are emitted
+	idx_t inner_column_count;
+	//! The filters of the replaced table scan, keyed by their column in the fetched chunk (if any)
+	unique_ptr<TableFilterSet> table_filters;
+	//! The filter on top of the replaced table scan, evaluated on the fetched chunk (if any)
+	unique_ptr<Expression> filter_expression;
+	//! Whether the table is the left side of the join, i.e., whether its columns are emitted first
+	bool inner_is_left;
+
+public:
+	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context) const override;
+	unique_ptr<GlobalOperatorState> GetGlobalOperatorState(ClientContext &context) const override;
+	OperatorResultType Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+	                           GlobalOperatorState &gstate, OperatorState &state) const override;
+
+	bool ParallelOperator() const override {
+		return true;
+	}
+
+	string ParamsToString() const override;
+};
+
+} // namespace duckdb
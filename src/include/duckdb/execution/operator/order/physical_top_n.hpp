@@ -12,6 +12,7 @@
 #include "duckdb/planner/bound_query_node.hpp"
 
 namespace duckdb {
+struct DynamicFilterData;
 
 //! Represents a physical ordering of the data. Note that this will not change
 //! the data but only add a selection vector.
@@ -26,6 +27,9 @@ public:
 	vector<BoundOrderByNode> orders;
 	idx_t limit;
 	idx_t offset;
+	//! The dynamic filter on the first order column in the table scan (if any). While the TopN runs, it is set to the
+	//! current boundary of the heap, so the scan can skip rows (and row groups) that cannot make it into the top-n
+	shared_ptr<DynamicFilterData> dynamic_filter;
 
 public:
 	// Source interface
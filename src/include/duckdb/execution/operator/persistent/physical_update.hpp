@@ -14,6 +14,8 @@
 
 namespace duckdb {
 class DataTable;
+class UpdateGlobalState;
+class UpdateLocalState;
 
 //! Physically update data in a table
 class PhysicalUpdate : public PhysicalOperator {
@@ -58,6 +60,10 @@ public:
 	bool ParallelSink() const override {
 		return true;
 	}
+
+private:
+	void BulkUpdate(ExecutionContext &context, UpdateGlobalState &gstate, UpdateLocalState &lstate,
+	                Vector &row_ids) const;
 };
 
 } // namespace duckdb
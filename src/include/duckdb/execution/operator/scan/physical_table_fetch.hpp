@@ -0,0 +1,45 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/scan/physical_table_fetch.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/physical_operator.hpp"
+
+namespace duckdb {
+class DuckTableEntry;
+
+//! Fetches the columns of the rows of a base table whose row ids are in the input, preserving the order of the input
+//! Used to materialize the payload columns of a table scan after the rows have been selected (late materialization)
+class PhysicalTableFetch : public PhysicalOperator {
+public:
+	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::TABLE_FETCH;
+
+public:
+	PhysicalTableFetch(vector<LogicalType> types, DuckTableEntry &table, vector<column_t> column_ids,
+	                   idx_t row_id_index, idx_t estimated_cardinality);
+
+	//! The table to fetch from
+	DuckTableEntry &table;
+	//! The storage indexes of the columns to fetch (or COLUMN_IDENTIFIER_ROW_ID)
+	vector<column_t> column_ids;
+	//! The index of the row id column in the input
+	idx_t row_id_index;
+
+public:
+	unique_ptr<OperatorState> GetOperatorState(ExecutionContext &context) const override;
+	OperatorResultType Execute(ExecutionContext &context, DataChunk &input, DataChunk &chunk,
+	                           GlobalOperatorState &gstate, OperatorState &state) const override;
+
+	bool ParallelOperator() const override {
+		return true;
+	}
+
+	string ParamsToString() const override;
+};
+
+} // namespace duckdb
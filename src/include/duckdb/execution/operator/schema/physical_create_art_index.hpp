@@ -23,6 +23,8 @@ class DuckTableEntry;
 class PhysicalCreateARTIndex : public PhysicalOperator {
 public:
 	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::CREATE_INDEX;
+	//! The maximum memory (in bytes) of the sorted keys buffered per thread before constructing their ART
+	static constexpr const idx_t SORTED_BUFFER_SIZE = 16ULL * 1024ULL * 1024ULL;
 
 public:
 	PhysicalCreateARTIndex(LogicalOperator &op, TableCatalogEntry &table, const vector<column_t> &column_ids,
@@ -56,8 +58,10 @@ public:
 
 	//! Sink for unsorted data: insert iteratively
 	SinkResultType SinkUnsorted(Vector &row_identifiers, OperatorSinkInput &input) const;
-	//! Sink for sorted data: build + merge
+	//! Sink for sorted data: buffer the keys of ascending ranges
 	SinkResultType SinkSorted(Vector &row_identifiers, OperatorSinkInput &input) const;
+	//! Construct the ART of the buffered sorted keys bottom-up, and merge it into the local index
+	void ConstructSorted(LocalSinkState &lstate) const;
 
 	SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override;
 	SinkCombineResultType Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const override;
@@ -20,6 +20,7 @@
 namespace duckdb {
 class ClientContext;
 class ColumnDataCollection;
+class PhysicalTableScan;
 
 //! The physical plan generator generates a physical execution plan from a
 //! logical query plan
@@ -46,6 +47,9 @@ public:
 	static bool PreserveInsertionOrder(ClientContext &context, PhysicalOperator &plan);
 
 	static bool HasEquality(vector<JoinCondition> &conds, idx_t &range_count);
+	//! Finds the table scan that produces column "column_idx" of "op", looking through projections and filters, and
+	//! that accepts dynamic filters. On success, "column_idx" is set to the column index within the scan
+	static optional_ptr<PhysicalTableScan> FindDynamicFilterScan(PhysicalOperator &op, idx_t &column_idx);
 
 protected:
 	unique_ptr<PhysicalOperator> CreatePlan(LogicalOperator &op);
@@ -97,6 +101,9 @@ protected:
 	unique_ptr<PhysicalOperator> PlanAsOfJoin(LogicalComparisonJoin &op);
 	unique_ptr<PhysicalOperator> PlanComparisonJoin(LogicalComparisonJoin &op);
 	unique_ptr<PhysicalOperator> PlanDelimJoin(LogicalComparisonJoin &op);
+	//! Plans a TopN over a table scan that only carries the order columns and the row ids, and fetches the other
+	//! columns of the selected rows afterwards. Returns nullptr if this is not possible or not worth it.
+	unique_ptr<PhysicalOperator> PlanLateMaterialization(LogicalTopN &op);
 	unique_ptr<PhysicalOperator> ExtractAggregateExpressions(unique_ptr<PhysicalOperator> child,
 	                                                         vector<unique_ptr<Expression>> &expressions,
 	                                                         vector<unique_ptr<Expression>> &groups);
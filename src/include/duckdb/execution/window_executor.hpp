@@ -150,6 +150,11 @@ public:
 	virtual void Finalize() {
 	}
 
+	//! Runs part of a Finalize that is in progress on another thread, returns false if there was nothing to run
+	virtual bool AssistFinalize() {
+		return false;
+	}
+
 	virtual unique_ptr<WindowExecutorState> GetExecutorState() const;
 
 	void Evaluate(idx_t row_idx, DataChunk &input_chunk, Vector &result, WindowExecutorState &lstate) const;
@@ -185,6 +190,7 @@ public:
 
 	void Sink(DataChunk &input_chunk, const idx_t input_idx, const idx_t total_count) override;
 	void Finalize() override;
+	bool AssistFinalize() override;
 
 	unique_ptr<WindowExecutorState> GetExecutorState() const override;
 
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/error_data.hpp"
 #include "duckdb/common/sort/sort.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/execution/physical_operator.hpp"
@@ -56,6 +57,10 @@ public:
 	//	Build
 	virtual void Sink(DataChunk &payload_chunk, SelectionVector *filter_sel, idx_t filtered);
 	virtual void Finalize(const FrameStats &stats);
+	//! Runs part of a Finalize that is in progress on another thread, returns false if there was nothing to run
+	virtual bool AssistFinalize() {
+		return false;
+	}
 
 	//	Probe
 	virtual unique_ptr<WindowAggregatorState> GetLocalState() const = 0;
@@ -152,6 +157,8 @@ public:
 	unique_ptr<WindowAggregatorState> gstate;
 };
 
+class WindowSegmentTreePart;
+
 class WindowSegmentTree : public WindowAggregator {
 
 public:
@@ -160,6 +167,7 @@ public:
 	~WindowSegmentTree() override;
 
 	void Finalize(const FrameStats &stats) override;
+	bool AssistFinalize() override;
 
 	unique_ptr<WindowAggregatorState> GetLocalState() const override;
 	void Evaluate(WindowAggregatorState &lstate, const DataChunk &bounds, Vector &result, idx_t count,
@@ -167,6 +175,10 @@ public:
 
 public:
 	void ConstructTree();
+	//! Computes the nodes [begin, end) of the level above the given level
+	void ConstructLevel(WindowSegmentTreePart &part, idx_t level, idx_t begin, idx_t end);
+	//! Claims and runs a task that computes the lower levels of the tree for a range of rows
+	bool ConstructTreeTask();
 
 	//! Use the combine API, if available
 	inline bool UseCombineAPI() const {
@@ -184,8 +196,23 @@ public:
 	//! Use the combine API, if available
 	WindowAggregationMode mode;
 
+	//! Serialise claiming the construction tasks
+	mutex tasks_lock;
+	//! The number of construction tasks, and the next task to claim
+	idx_t tasks_total;
+	idx_t tasks_claimed;
+	//! The number of finished construction tasks
+	atomic<idx_t> tasks_completed;
+	//! The error of a construction task that failed (if any)
+	ErrorData task_error;
+	//! The allocators used by the construction tasks, which may be referenced by the tree states
+	vector<unique_ptr<ArenaAllocator>> task_allocators;
+
 	// TREE_FANOUT needs to cleanly divide STANDARD_VECTOR_SIZE
 	static constexpr idx_t TREE_FANOUT = 16;
+	//! Every construction task computes this many lower levels (TREE_FANOUT^4 = 65536 rows)
+	static constexpr idx_t TASK_LEVELS = 4;
+	static constexpr idx_t TASK_ROWS = TREE_FANOUT * TREE_FANOUT * TREE_FANOUT * TREE_FANOUT;
 };
 
 class WindowDistinctAggregator : public WindowAggregator {
@@ -145,4 +145,8 @@ struct PragmaUserAgent {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
 
+struct PragmaBufferPoolStatistics {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
 } // namespace duckdb
@@ -17,7 +17,9 @@ class DuckTableEntry;
 class TableCatalogEntry;
 
 struct TableScanBindData : public TableFunctionData {
-	explicit TableScanBindData(DuckTableEntry &table) : table(table), is_index_scan(false), is_create_index(false) {
+	explicit TableScanBindData(DuckTableEntry &table)
+	    : table(table), is_index_scan(false), is_create_index(false), order_column(DConstants::INVALID_INDEX),
+	      order_descending(false), order_row_count(0) {
 	}
 
 	//! The table to scan
@@ -29,11 +31,18 @@ struct TableScanBindData : public TableFunctionData {
 	bool is_create_index;
 	//! The row ids to fetch (in case of an index scan)
 	vector<row_t> result_ids;
+	//! The column whose index is scanned in key order (in case of an index order scan)
+	column_t order_column;
+	//! Whether or not the index is scanned in descending key order
+	bool order_descending;
+	//! The number of rows with the smallest (or largest) keys that must be emitted by the index order scan
+	idx_t order_row_count;
 
 public:
 	bool Equals(const FunctionData &other_p) const override {
 		auto &other = other_p.Cast<TableScanBindData>();
-		return &other.table == &table && result_ids == other.result_ids;
+		return &other.table == &table && result_ids == other.result_ids && order_column == other.order_column &&
+		       order_descending == other.order_descending && order_row_count == other.order_row_count;
 	}
 };
 
@@ -42,6 +51,9 @@ struct TableScanFunction {
 	static void RegisterFunction(BuiltinFunctions &set);
 	static TableFunction GetFunction();
 	static TableFunction GetIndexScanFunction();
+	static TableFunction GetIndexOrderScanFunction();
+	//! Whether or not the table has an ART index on exactly the given column, which can be scanned in key order
+	static bool HasOrderIndex(ClientContext &context, DuckTableEntry &table, column_t column_id);
 };
 
 } // namespace duckdb
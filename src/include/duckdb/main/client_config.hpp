@@ -14,6 +14,7 @@
 #include "duckdb/common/enums/profiler_format.hpp"
 #include "duckdb/common/types/value.hpp"
 #include "duckdb/common/progress_bar/progress_bar.hpp"
+#include "duckdb/parallel/task.hpp"
 
 namespace duckdb {
 
@@ -81,6 +82,8 @@ struct ClientConfig {
 	bool force_fetch_row = false;
 	//! Use range joins for inequalities, even if there are equality predicates
 	bool prefer_range_joins = false;
+	//! Use an index join for equality joins on an indexed column, even if the other side is not much smaller
+	bool force_index_join = false;
 	//! If this context should also try to use the available replacement scans
 	//! True by default
 	bool use_replacement_scans = true;
@@ -92,6 +95,21 @@ struct ClientConfig {
 	//! The number of rows to accumulate before flushing during a partitioned write
 	idx_t partitioned_write_flush_threshold = idx_t(1) << idx_t(19);
 
+	//! The number of rows after which an UPDATE deletes and re-appends the updated rows, instead of storing the new
+	//! values as in-place updates that every scan has to merge in (0 = never)
+	//! Disabled by default: re-appending fetches every column of the updated rows, changes their row ids and writes
+	//! the full rows to the WAL, which makes the UPDATE itself considerably slower
+	idx_t bulk_update_threshold = 0;
+
+	//! The maximum LIMIT + OFFSET of a TopN over a table scan for which the columns that are not required for the
+	//! ordering are fetched after the TopN (late materialization), instead of being scanned for every row
+	idx_t late_materialization_max_rows = 1000;
+
+	//! The priority class of the tasks of the queries of this connection
+	TaskPriority query_priority = TaskPriority::NORMAL;
+	//! The maximum number of background threads that work on a single query at the same time (0 = no limit)
+	idx_t max_query_threads = 0;
+
 	//! Callback to create a progress bar display
 	progress_bar_display_create_func_t display_create_func = nullptr;
 
@@ -56,6 +56,10 @@ enum class CheckpointAbort : uint8_t {
 	DEBUG_ABORT_AFTER_FREE_LIST_WRITE = 3
 };
 
+enum class TemporaryFileCompression : uint8_t { NONE = 0, LZ4 = 1 };
+
+enum class ThreadPinMode : uint8_t { OFF = 0, ON = 1, AUTO = 2 };
+
 typedef void (*set_global_function_t)(DatabaseInstance *db, DBConfig &config, const Value &parameter);
 typedef void (*set_local_function_t)(ClientContext &context, const Value &parameter);
 typedef void (*reset_global_function_t)(DatabaseInstance *db, DBConfig &config);
@@ -119,6 +123,12 @@ struct DBConfigOptions {
 	AccessMode access_mode = AccessMode::AUTOMATIC;
 	//! Checkpoint when WAL reaches this size (default: 16MB)
 	idx_t checkpoint_wal_size = 1 << 24;
+	//! Whether or not automatic checkpoints run in a background thread. Appends that are committed while the
+	//! checkpoint runs are written to a separate WAL and to new row groups, other writers wait for the checkpoint
+	bool background_checkpoint = false;
+	//! The time (in microseconds) that a commit waits before syncing the WAL. Commits that arrive in the meantime
+	//! are made durable by the same sync
+	idx_t commit_delay = 0;
 	//! Whether or not to use Direct IO, bypassing operating system buffers
 	bool use_direct_io = false;
 	//! Whether extensions should be loaded on start-up
@@ -148,10 +158,17 @@ struct DBConfigOptions {
 	//! The number of external threads that work on DuckDB tasks. Default: 1.
 	//! Must be smaller or equal to maximum_threads.
 	idx_t external_threads = 1;
+	//! Whether to pin the background threads to CPUs. Default: only if there are multiple NUMA nodes (Linux only).
+	ThreadPinMode pin_threads = ThreadPinMode::AUTO;
+	//! Whether the tasks of a query are only executed by the background threads of the NUMA node of the query,
+	//! instead of being stolen by the threads of other nodes when they run out of work
+	bool numa_bind_queries = false;
 	//! Whether or not to create and use a temporary directory to store intermediates that do not fit in memory
 	bool use_temporary_directory = true;
 	//! Directory to store temporary structures that do not fit in memory
 	string temporary_directory;
+	//! The compression of the blocks that are written to the temporary directory
+	TemporaryFileCompression temp_file_compression = TemporaryFileCompression::NONE;
 	//! Whether or not to invoke filesystem trim on free blocks after checkpoint. This will reclaim
 	//! space for sparse files, on platforms that support it.
 	bool trim_free_blocks = false;
@@ -105,6 +105,8 @@ public:
 
 	//! Adds the timings gathered by an OperatorProfiler to this query profiler
 	DUCKDB_API void Flush(OperatorProfiler &profiler);
+	//! Updates the information of the operators that report information that is only known after execution
+	DUCKDB_API void UpdateRuntimeInfo();
 
 	DUCKDB_API void StartPhase(string phase);
 	DUCKDB_API void EndPhase();
@@ -171,6 +173,9 @@ private:
 	//! Check whether or not an operator type requires query profiling. If none of the ops in a query require profiling
 	//! no profiling information is output.
 	bool OperatorRequiresProfiling(PhysicalOperatorType op_type);
+	//! Check whether or not an operator type reports information that is only known after execution
+	bool OperatorReportsRuntimeInfo(PhysicalOperatorType op_type);
+	void UpdateRuntimeInfoInternal();
 };
 
 } // namespace duckdb
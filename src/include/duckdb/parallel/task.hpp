@@ -21,6 +21,10 @@ enum class TaskExecutionMode : uint8_t { PROCESS_ALL, PROCESS_PARTIAL };
 
 enum class TaskExecutionResult : uint8_t { TASK_FINISHED, TASK_NOT_FINISHED, TASK_ERROR, TASK_BLOCKED };
 
+//! The priority class of the tasks of a producer (i.e., of a query)
+enum class TaskPriority : uint8_t { LOW = 0, NORMAL = 1, HIGH = 2 };
+static constexpr const idx_t TASK_PRIORITY_COUNT = 3;
+
 //! Generic parallel task
 class Task : public enable_shared_from_this<Task> {
 public:
@@ -23,6 +23,9 @@ class DatabaseInstance;
 class TaskScheduler;
 
 struct SchedulerThread;
+struct NumaTopology;
+struct ScheduledTask;
+struct TaskConsumer;
 
 struct ProducerToken {
 	ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token);
@@ -46,12 +49,16 @@ public:
 	DUCKDB_API static TaskScheduler &GetScheduler(DatabaseInstance &db);
 
 	unique_ptr<ProducerToken> CreateProducer();
+	//! Creates a producer whose tasks are scheduled with the given priority, and are executed by at most
+	//! `max_threads` background threads at the same time (0 = no limit)
+	unique_ptr<ProducerToken> CreateProducer(TaskPriority priority, idx_t max_threads);
 	//! Schedule a task to be executed by the task scheduler
 	void ScheduleTask(ProducerToken &producer, shared_ptr<Task> task);
 	//! Fetches a task from a specific producer, returns true if successful or false if no tasks were available
 	bool GetTaskFromProducer(ProducerToken &token, shared_ptr<Task> &task);
 	//! Run tasks forever until "marker" is set to false, "marker" must remain valid until the thread is joined
-	void ExecuteForever(atomic<bool> *marker);
+	//! Tasks are taken from the queue of the given NUMA node first, and stolen from the other nodes otherwise
+	void ExecuteForever(atomic<bool> *marker, idx_t node = 0);
 	//! Run tasks until `marker` is set to false, `max_tasks` have been completed, or until there are no more tasks
 	//! available. Returns the number of tasks that were completed.
 	idx_t ExecuteTasks(atomic<bool> *marker, idx_t max_tasks);
@@ -64,6 +71,8 @@ public:
 	void SetThreads(idx_t total_threads, idx_t external_threads);
 
 	void RelaunchThreads();
+	//! Relaunch all background threads the next time RelaunchThreads is called (e.g. to change the thread pinning)
+	void RequireRelaunch();
 
 	//! Returns the number of threads
 	DUCKDB_API int32_t NumberOfThreads();
@@ -79,11 +88,27 @@ public:
 
 private:
 	void RelaunchThreadsInternal(int32_t n);
+	//! Dequeues a task from the queue of the given node, or steals one from the queues of the other nodes
+	//! The priority classes are visited in a weighted round-robin order, the producers of a class round-robin
+	bool DequeueTask(TaskConsumer &consumer, idx_t node, bool steal, ScheduledTask &task);
+	//! Dequeues a task that may be executed by this thread, i.e., whose producer has not reached its thread limit
+	bool DequeueRunnableTask(TaskConsumer &consumer, idx_t node, bool steal, ScheduledTask &task);
+	//! Executes a task in PROCESS_ALL mode, followed by the tasks of the same producer that were waiting for a thread
+	//! Returns the number of tasks that were completed
+	idx_t ExecuteScheduledTask(ScheduledTask &task);
 
 private:
 	DatabaseInstance &db;
-	//! The task queue
-	unique_ptr<ConcurrentQueue> queue;
+	//! The NUMA nodes and their CPUs
+	unique_ptr<NumaTopology> topology;
+	//! The task queues, one per NUMA node
+	vector<unique_ptr<ConcurrentQueue>> queues;
+	//! The number of NUMA nodes that have background threads, producers are assigned to these nodes
+	atomic<idx_t> active_node_count;
+	//! Used to assign producers to NUMA nodes round-robin
+	atomic<idx_t> next_producer_node;
+	//! Whether all background threads have to be relaunched
+	atomic<bool> relaunch_required;
 	//! Lock for modifying the thread count
 	mutex thread_lock;
 	//! The active background threads of the task scheduler
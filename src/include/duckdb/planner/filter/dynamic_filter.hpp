@@ -0,0 +1,77 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/dynamic_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/bloom_filter.hpp"
+#include "duckdb/common/mutex.hpp"
+
+namespace duckdb {
+
+//! The state of a dynamic filter. This is shared between the operator that produces the filter during execution
+//! (e.g., the build side of a hash join) and the scan(s) that consume it.
+//! The Bloom filter must be set before the consuming scan starts scanning, which holds for the probe side of a hash
+//! join, as its pipeline depends on the build. The filter on the value range can also be replaced while the scan is
+//! running (e.g., by a top-N that tightens its boundary), the scan then picks up the new filter for the next vector.
+struct DynamicFilterData {
+public:
+	DynamicFilterData() : initialized(false) {
+	}
+
+	//! Sets the filter on the value range, and the Bloom filter over the hashes of the admissible values (if any)
+	void SetFilter(unique_ptr<TableFilter> filter, shared_ptr<BloomFilter> bloom_filter, LogicalType bloom_filter_type);
+	//! Replaces the filter on the value range, this can be done while the consuming scan is running
+	void UpdateFilter(unique_ptr<TableFilter> filter);
+	//! Resets the filter, after which it does not filter anything
+	void Reset();
+	//! Returns the current filter on the value range (if any)
+	shared_ptr<TableFilter> GetFilter() const;
+
+	//! Applies the Bloom filter to the "count" entries in "sel" (which index into "vector"). Returns the number of
+	//! remaining entries
+	idx_t FilterBloom(Vector &vector, SelectionVector &sel, idx_t count) const;
+
+public:
+	//! The Bloom filter over the hashes of the admissible values (if any)
+	shared_ptr<BloomFilter> bloom_filter;
+	//! The type of the values whose hashes were inserted into the Bloom filter
+	LogicalType bloom_filter_type;
+	//! Whether or not the filter has been set
+	atomic<bool> initialized;
+
+private:
+	//! Protects the filter on the value range
+	mutable mutex lock;
+	//! The filter on the value range (if any)
+	shared_ptr<TableFilter> filter;
+};
+
+//! DynamicFilter is a filter whose contents are only known during execution, e.g., the range of the join keys on the
+//! build side of a hash join, which is pushed into the table scan on the probe side. Until it is set, it does nothing
+class DynamicFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::DYNAMIC_FILTER;
+
+public:
+	DynamicFilter();
+	explicit DynamicFilter(shared_ptr<DynamicFilterData> filter_data);
+
+	//! The shared filter state
+	shared_ptr<DynamicFilterData> filter_data;
+
+public:
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) override;
+	string ToString(const string &column_name) override;
+	bool Equals(const TableFilter &other) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+};
+
+} // namespace duckdb
@@ -55,6 +55,7 @@ struct TempBufferPoolReservation : BufferPoolReservation {
 class BlockHandle {
 	friend class BlockManager;
 	friend struct BufferEvictionNode;
+	friend struct EvictionQueue;
 	friend class BufferHandle;
 	friend class BufferManager;
 	friend class StandardBufferManager;
@@ -126,6 +127,8 @@ private:
 	atomic<idx_t> eviction_seq_num;
 	//! LRU timestamp (for age-based eviction)
 	atomic<int64_t> lru_timestamp_msec;
+	//! Whether the block was pinned again while it was loaded, such blocks get a second chance before being evicted
+	atomic<bool> referenced;
 	//! Whether or not the buffer can be destroyed (only used for temporary buffers)
 	bool can_destroy;
 	//! The memory usage of the block (when loaded). If we are pinning/loading
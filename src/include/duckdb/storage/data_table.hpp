@@ -154,6 +154,8 @@ public:
 	//! commit (e.g. because of an I/O exception)
 	void RevertAppend(idx_t start_row, idx_t count);
 	void RevertAppendInternal(idx_t start_row);
+	//! Compact the version info of a set of rows once their changes are visible to every transaction
+	void CleanupVersions(transaction_t lowest_active_start, idx_t row_start, idx_t count);
 
 	void ScanTableSegment(idx_t start_row, idx_t count, const std::function<void(DataChunk &chunk)> &function);
 
@@ -189,6 +191,8 @@ public:
 	unique_ptr<StorageLockKey> GetCheckpointLock();
 	//! Checkpoint the table to the specified table data writer
 	void Checkpoint(TableDataWriter &writer, Serializer &serializer);
+	//! Seals the row groups of the table at the start of a background checkpoint
+	void SealRowGroups();
 	void CommitDropTable();
 	void CommitDropColumn(idx_t index);
 
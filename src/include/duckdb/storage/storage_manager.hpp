@@ -33,6 +33,10 @@ public:
 
 	// Make the commit persistent
 	virtual void FlushCommit() = 0;
+	// Wait until the commit is durable. This is called after FlushCommit, without holding the transaction lock, so
+	// concurrent commits can be made durable together
+	virtual void SyncCommit() {
+	}
 };
 
 struct CheckpointOptions {
@@ -71,6 +75,19 @@ public:
 	optional_ptr<WriteAheadLog> GetWAL();
 	//! Deletes the WAL file, and resets the unique pointer.
 	void ResetWAL();
+	//! Gets the WAL that contains the changes that are written by a checkpoint. While a background checkpoint runs,
+	//! this is not the WAL that commits are written to
+	optional_ptr<WriteAheadLog> GetCheckpointWAL();
+
+	//! Starts a background checkpoint: the row groups of all tables are sealed, and commits are written to a separate
+	//! WAL until the checkpoint is finished
+	void BeginBackgroundCheckpoint();
+	//! Finishes a background checkpoint after the database header has been written: the WAL of the checkpointed
+	//! changes is removed, and the WAL that commits were written to during the checkpoint takes its place
+	void FinishBackgroundCheckpoint();
+	bool InBackgroundCheckpoint() const {
+		return checkpoint_wal != nullptr;
+	}
 
 	//! Returns the database file path
 	string GetDBPath() const {
@@ -81,6 +98,8 @@ public:
 	}
 	//! The path to the WAL, derived from the database file path
 	string GetWALPath();
+	//! The path to the WAL that commits are written to while a background checkpoint runs
+	string GetBackgroundWALPath();
 	bool InMemory();
 
 	virtual bool AutomaticCheckpoint(idx_t estimated_wal_bytes) = 0;
@@ -93,6 +112,8 @@ public:
 
 protected:
 	virtual void LoadDatabase() = 0;
+	//! Seals the row groups of all tables, see RowGroupCollection::SealRowGroups
+	void SealTables();
 
 protected:
 	//! The database this storage manager belongs to
@@ -101,6 +122,8 @@ protected:
 	string path;
 	//! The WriteAheadLog of the storage manager
 	unique_ptr<WriteAheadLog> wal;
+	//! While a background checkpoint runs: the WAL that contains the changes that are being checkpointed
+	unique_ptr<WriteAheadLog> checkpoint_wal;
 	//! Whether or not the database is opened in read-only mode
 	bool read_only;
 	//! When loading a database, we do not yet set the wal-field. Therefore, GetWriteAheadLog must
@@ -47,6 +47,9 @@ public:
 	virtual idx_t GetCommittedDeletedCount(idx_t max_count) = 0;
 
 	virtual bool HasDeletes() const = 0;
+	//! Compacts the version info of rows whose inserts and deletes are visible to every transaction that starts at or
+	//! after lowest_active_start. Returns true if all rows are visible and the chunk info can be dropped entirely.
+	virtual bool Cleanup(transaction_t lowest_active_start) = 0;
 
 	virtual void Write(WriteStream &writer) const;
 	static unique_ptr<ChunkInfo> Read(ReadStream &reader);
@@ -88,6 +91,7 @@ public:
 	idx_t GetCommittedDeletedCount(idx_t max_count) override;
 
 	bool HasDeletes() const override;
+	bool Cleanup(transaction_t lowest_active_start) override;
 
 	void Write(WriteStream &writer) const override;
 	static unique_ptr<ChunkInfo> Read(ReadStream &reader);
@@ -105,13 +109,19 @@ public:
 public:
 	explicit ChunkVectorInfo(idx_t start);
 
-	//! The transaction ids of the transactions that inserted the tuples (if any)
-	transaction_t inserted[STANDARD_VECTOR_SIZE];
+	static constexpr const idx_t DELETED_MASK_ENTRIES = (STANDARD_VECTOR_SIZE + 63) / 64;
+
+	//! The transaction ids of the transactions that inserted the tuples
+	//! Only allocated if the tuples were not all inserted by the same transaction (insert_id)
+	unsafe_unique_array<transaction_t> inserted;
 	transaction_t insert_id;
 	bool same_inserted_id;
 
 	//! The transaction ids of the transactions that deleted the tuples (if any)
-	transaction_t deleted[STANDARD_VECTOR_SIZE];
+	//! Not allocated if there are no deletes, or if all deletes are committed and older than any running transaction -
+	//! in the latter case the deleted tuples are stored in deleted_mask instead
+	unsafe_unique_array<transaction_t> deleted;
+	uint64_t deleted_mask[DELETED_MASK_ENTRIES];
 	bool any_deleted;
 
 public:
@@ -135,11 +145,28 @@ public:
 	void CommitDelete(transaction_t commit_id, const DeleteInfo &info);
 
 	bool HasDeletes() const override;
+	bool Cleanup(transaction_t lowest_active_start) override;
 
 	void Write(WriteStream &writer) const override;
 	static unique_ptr<ChunkInfo> Read(ReadStream &reader);
 
 private:
+	//! Whether or not the deleted tuples are stored as a bitmask instead of as transaction ids
+	bool HasCompactDeletes() const {
+		return any_deleted && !deleted;
+	}
+	bool IsDeletedInMask(idx_t row) const {
+		return deleted_mask[row / 64] & (uint64_t(1) << (row % 64));
+	}
+	transaction_t GetInsertId(idx_t row) const {
+		return inserted ? inserted[row] : insert_id;
+	}
+	transaction_t GetDeleteId(idx_t row) const;
+	//! Allocates the per-row insert ids
+	void InitializeInserted();
+	//! Allocates the per-row delete ids, expanding the bitmask of deleted tuples if there is one
+	void InitializeDeleted();
+
 	template <class OP>
 	idx_t TemplatedGetSelVector(transaction_t start_time, transaction_t transaction_id, SelectionVector &sel_vector,
 	                            idx_t max_count) const;
@@ -49,6 +49,11 @@ public:
 	string GetTableName();
 	void SetTableName(string name);
 
+	//! Marks that the rows deleted by the transaction with the given commit id were removed from the indexes
+	void SetIndexCleanupCommit(transaction_t commit_id);
+	//! Whether or not the indexes contain all the rows that are visible to a transaction with the given start time
+	bool IndexesContainVisibleRows(transaction_t start_time) const;
+
 private:
 	//! The database instance of the table
 	AttachedDatabase &db;
@@ -66,6 +71,9 @@ private:
 	vector<IndexStorageInfo> index_storage_infos;
 	//! Lock held while checkpointing
 	StorageLock checkpoint_lock;
+	//! The highest commit id of the transactions whose deleted rows were removed from the indexes, transactions that
+	//! started before it can not find all of their visible rows through the indexes
+	atomic<transaction_t> index_cleanup_commit_id;
 };
 
 } // namespace duckdb
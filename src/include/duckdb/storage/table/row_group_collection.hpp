@@ -78,6 +78,7 @@ public:
 	void FinalizeAppend(TransactionData transaction, TableAppendState &state);
 	void CommitAppend(transaction_t commit_id, idx_t row_start, idx_t count);
 	void RevertAppendInternal(idx_t start_row);
+	void CleanupVersions(transaction_t lowest_active_start, idx_t row_start, idx_t count);
 
 	void MergeStorage(RowGroupCollection &data);
 
@@ -89,6 +90,9 @@ public:
 	                  DataChunk &updates);
 
 	void Checkpoint(TableDataWriter &writer, TableStatistics &global_stats);
+	//! Seals the current row groups for a background checkpoint: rows that are appended from now on are placed in new
+	//! row groups, and the next checkpoint only writes the sealed row groups
+	void SealRowGroups();
 
 	void InitializeVacuumState(CollectionCheckpointState &checkpoint_state, VacuumState &state,
 	                           vector<SegmentNode<RowGroup>> &segments);
@@ -127,6 +131,7 @@ public:
 
 private:
 	bool IsEmpty(SegmentLock &) const;
+	void CheckpointSealedRowGroups(TableDataWriter &writer, TableStatistics &global_stats);
 
 private:
 	//! BlockManager
@@ -144,6 +149,8 @@ private:
 	TableStatistics stats;
 	//! Allocation size, only tracked for appends
 	idx_t allocation_size;
+	//! The number of row groups that are sealed for a background checkpoint (or INVALID_INDEX)
+	idx_t sealed_row_groups;
 };
 
 } // namespace duckdb
@@ -37,6 +37,9 @@ public:
 	void AppendVersionInfo(TransactionData transaction, idx_t count, idx_t row_group_start, idx_t row_group_end);
 	void CommitAppend(transaction_t commit_id, idx_t row_group_start, idx_t count);
 	void RevertAppend(idx_t start_row);
+	//! Compacts (or drops) the version info of the given rows once all of their changes are visible to every
+	//! transaction that starts at or after lowest_active_start
+	void CleanupVersions(transaction_t lowest_active_start, idx_t row_group_start, idx_t count);
 
 	idx_t DeleteRows(idx_t vector_idx, transaction_t transaction_id, row_t rows[], idx_t count);
 	void CommitDelete(idx_t vector_idx, transaction_t commit_id, const DeleteInfo &info);
@@ -25,9 +25,17 @@ namespace duckdb {
 
 class TemporaryFileManager;
 
+//! Temporary files are divided in slots of a fixed size. Uncompressed blocks are written to files with slots of
+//! Storage::BLOCK_ALLOC_SIZE, compressed blocks are written to files with the smallest slot size that fits them.
+//! There are TEMPORARY_SLOT_SIZE_COUNT slot sizes, which are multiples of TEMPORARY_SLOT_SIZE_UNIT.
+static constexpr idx_t TEMPORARY_SLOT_SIZE_COUNT = 8;
+static constexpr idx_t TEMPORARY_SLOT_SIZE_UNIT = Storage::BLOCK_ALLOC_SIZE / TEMPORARY_SLOT_SIZE_COUNT;
+//! The size class of the slots that hold uncompressed blocks
+static constexpr idx_t TEMPORARY_UNCOMPRESSED_SIZE_CLASS = TEMPORARY_SLOT_SIZE_COUNT - 1;
+
 struct BlockIndexManager {
 public:
-	explicit BlockIndexManager(TemporaryFileManager &manager);
+	BlockIndexManager(TemporaryFileManager &manager, idx_t slot_size);
 	BlockIndexManager();
 
 public:
@@ -45,6 +53,8 @@ private:
 
 private:
 	idx_t max_index;
+	//! The size of a slot on disk, used to keep track of the size of the temporary files
+	idx_t slot_size;
 	set<idx_t> free_indexes;
 	set<idx_t> indexes_in_use;
 	optional_ptr<TemporaryFileManager> manager;
@@ -56,9 +66,12 @@ private:
 
 // FIXME: should be optional_idx
 struct TemporaryFileIndex {
-	explicit TemporaryFileIndex(idx_t file_index = DConstants::INVALID_INDEX,
+	explicit TemporaryFileIndex(idx_t size_class = TEMPORARY_UNCOMPRESSED_SIZE_CLASS,
+	                            idx_t file_index = DConstants::INVALID_INDEX,
 	                            idx_t block_index = DConstants::INVALID_INDEX);
 
+	//! The size class of the slots in the file, the slot size is (size_class + 1) * TEMPORARY_SLOT_SIZE_UNIT
+	idx_t size_class;
 	idx_t file_index;
 	idx_t block_index;
 
@@ -75,7 +88,7 @@ class TemporaryFileHandle {
 
 public:
 	TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory, idx_t index,
-	                    TemporaryFileManager &manager);
+	                    idx_t size_class, TemporaryFileManager &manager);
 
 public:
 	struct TemporaryFileLock {
@@ -88,7 +101,8 @@ public:
 
 public:
 	TemporaryFileIndex TryGetBlockIndex();
-	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index);
+	//! Writes the buffer to the slot, or the compressed buffer if the slots of this file hold compressed blocks
+	void WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index, AllocatedData &compressed_buffer);
 	unique_ptr<FileBuffer> ReadTemporaryBuffer(idx_t block_index, unique_ptr<FileBuffer> reusable_buffer);
 	void EraseBlockIndex(block_id_t block_index);
 	bool DeleteIfEmpty();
@@ -104,6 +118,8 @@ private:
 	DatabaseInstance &db;
 	unique_ptr<FileHandle> handle;
 	idx_t file_index;
+	idx_t size_class;
+	idx_t slot_size;
 	string path;
 	mutex file_lock;
 	BlockIndexManager index_manager;
@@ -159,23 +175,25 @@ public:
 	void DecreaseSizeOnDisk(idx_t amount);
 
 private:
+	//! Compresses the buffer if temporary file compression is enabled, returns the size class of the slot to write to
+	idx_t CompressBuffer(FileBuffer &buffer, AllocatedData &compressed_buffer);
 	void EraseUsedBlock(TemporaryManagerLock &lock, block_id_t id, TemporaryFileHandle *handle,
 	                    TemporaryFileIndex index);
-	TemporaryFileHandle *GetFileHandle(TemporaryManagerLock &, idx_t index);
+	TemporaryFileHandle *GetFileHandle(TemporaryManagerLock &, TemporaryFileIndex index);
 	TemporaryFileIndex GetTempBlockIndex(TemporaryManagerLock &, block_id_t id);
-	void EraseFileHandle(TemporaryManagerLock &, idx_t file_index);
+	void EraseFileHandle(TemporaryManagerLock &, TemporaryFileIndex index);
 
 private:
 	DatabaseInstance &db;
 	mutex manager_lock;
 	//! The temporary directory
 	string temp_directory;
-	//! The set of active temporary file handles
-	unordered_map<idx_t, unique_ptr<TemporaryFileHandle>> files;
+	//! The set of active temporary file handles, per size class
+	unordered_map<idx_t, unique_ptr<TemporaryFileHandle>> files[TEMPORARY_SLOT_SIZE_COUNT];
 	//! map of block_id -> temporary file position
 	unordered_map<block_id_t, TemporaryFileIndex> used_blocks;
-	//! Manager of in-use temporary file indexes
-	BlockIndexManager index_manager;
+	//! Manager of in-use temporary file indexes, per size class
+	BlockIndexManager index_managers[TEMPORARY_SLOT_SIZE_COUNT];
 	//! The size in bytes of the temporary files that are currently alive
 	atomic<idx_t> size_on_disk;
 	//! The max amount of disk space that can be used
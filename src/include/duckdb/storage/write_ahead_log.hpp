@@ -14,12 +14,15 @@
 #include "duckdb/catalog/catalog_entry/table_macro_catalog_entry.hpp"
 #include "duckdb/common/enums/wal_type.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/common/serializer/buffered_file_writer.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/storage/block.hpp"
 #include "duckdb/storage/storage_info.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 
 struct AlterInfo;
@@ -116,6 +119,12 @@ public:
 	//! Delete the WAL file on disk. The WAL should not be used after this point.
 	void Delete();
 	void Flush();
+	//! Marks the end of a commit and writes the WAL to the file, without syncing it. Returns the position up to
+	//! which the WAL has to be synced (using SyncCommit) to make the commit durable
+	idx_t FlushCommit();
+	//! Syncs the WAL up to (at least) the given position. Commits that call this concurrently are made durable by
+	//! the same sync (group commit)
+	void SyncCommit(idx_t position);
 
 	void WriteCheckpoint(MetaBlockPointer meta_block);
 
@@ -123,6 +132,16 @@ protected:
 	AttachedDatabase &database;
 	unique_ptr<BufferedFileWriter> writer;
 	string wal_path;
+
+	//! The lock and condition variable used to wait for the sync of the WAL
+	mutex sync_lock;
+	std::condition_variable sync_cv;
+	//! Whether or not a commit is currently syncing the WAL
+	bool sync_in_progress;
+	//! The highest position that a commit has requested to be synced
+	idx_t requested_sync_position;
+	//! The position up to which the WAL has been synced
+	idx_t synced_position;
 };
 
 } // namespace duckdb
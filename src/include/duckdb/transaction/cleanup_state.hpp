@@ -16,12 +16,13 @@ namespace duckdb {
 
 class DataTable;
 
+struct AppendInfo;
 struct DeleteInfo;
 struct UpdateInfo;
 
 class CleanupState {
 public:
-	CleanupState();
+	CleanupState(transaction_t lowest_active_transaction, transaction_t commit_id);
 	~CleanupState();
 
 	// all tables with indexes that possibly need a vacuum (after e.g. a delete)
@@ -31,6 +32,10 @@ public:
 	void CleanupEntry(UndoFlags type, data_ptr_t data);
 
 private:
+	//! The start time of the oldest transaction that is still running
+	transaction_t lowest_active_transaction;
+	//! The commit id of the transaction that is cleaned up
+	transaction_t commit_id;
 	// data for index cleanup
 	optional_ptr<DataTable> current_table;
 	DataChunk chunk;
@@ -38,6 +43,7 @@ private:
 	idx_t count;
 
 private:
+	void CleanupAppend(AppendInfo &info);
 	void CleanupDelete(DeleteInfo &info);
 	void CleanupUpdate(UpdateInfo &info);
 
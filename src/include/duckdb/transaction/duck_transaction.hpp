@@ -14,6 +14,7 @@
 namespace duckdb {
 class RowVersionManager;
 class DuckTransactionManager;
+class StorageCommitState;
 class StorageLockKey;
 struct UndoBufferProperties;
 
@@ -40,17 +41,24 @@ public:
 	void PushCatalogEntry(CatalogEntry &entry, data_ptr_t extra_data = nullptr, idx_t extra_data_size = 0);
 
 	void SetReadWrite() override;
+	void ModifyExistingData() override;
+	//! Whether or not the transaction holds the (shared) checkpoint lock
+	bool HasCheckpointLock() const {
+		return write_lock != nullptr;
+	}
 
 	//! Commit the current transaction with the given commit identifier. Returns an error message if the transaction
 	//! commit failed, or an empty string if the commit was sucessful
 	ErrorData Commit(AttachedDatabase &db, transaction_t commit_id, bool checkpoint) noexcept;
+	//! Waits until the commit has been made durable, if Commit has left the sync of the WAL to the caller
+	ErrorData SyncCommit() noexcept;
 	//! Returns whether or not a commit of this transaction should trigger an automatic checkpoint
 	bool AutomaticCheckpoint(AttachedDatabase &db, const UndoBufferProperties &properties);
 
 	//! Rollback
 	void Rollback() noexcept;
 	//! Cleanup the undo buffer
-	void Cleanup();
+	void Cleanup(transaction_t lowest_active_transaction);
 
 	bool ChangesMade();
 	UndoBufferProperties GetUndoProperties();
@@ -76,6 +84,8 @@ private:
 	unique_ptr<LocalStorage> storage;
 	//! Write lock
 	unique_ptr<StorageLockKey> write_lock;
+	//! The commit state of a commit whose WAL has not been synced yet (see SyncCommit)
+	unique_ptr<StorageCommitState> storage_commit_state;
 	//! Lock for accessing sequence_usage
 	mutex sequence_lock;
 	//! Map of all sequences that were used during the transaction and the value they had in this transaction
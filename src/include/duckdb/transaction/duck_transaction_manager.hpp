@@ -11,6 +11,7 @@
 #include "duckdb/transaction/transaction_manager.hpp"
 #include "duckdb/storage/storage_lock.hpp"
 #include "duckdb/common/enums/checkpoint_type.hpp"
+#include "duckdb/common/thread.hpp"
 
 namespace duckdb {
 class DuckTransaction;
@@ -52,6 +53,13 @@ public:
 	unique_ptr<StorageLockKey> SharedCheckpointLock();
 	unique_ptr<StorageLockKey> TryUpgradeCheckpointLock(StorageLockKey &lock);
 
+	//! Whether or not an automatic checkpoint is running in the background (see the "background_checkpoint" setting)
+	bool BackgroundCheckpointRunning() const {
+		return background_checkpoint_running;
+	}
+	//! Waits until the background checkpoint (if any) has finished
+	void WaitForBackgroundCheckpoint();
+
 protected:
 	struct CheckpointDecision {
 		explicit CheckpointDecision(string reason_p);
@@ -74,6 +82,11 @@ private:
 	//! Whether or not we can checkpoint
 	CheckpointDecision CanCheckpoint(DuckTransaction &transaction, unique_ptr<StorageLockKey> &checkpoint_lock,
 	                                 const UndoBufferProperties &properties);
+	//! Whether or not a transaction without the checkpoint lock can commit while the background checkpoint is running
+	bool CanCommitDuringCheckpoint(DuckTransaction &transaction);
+	//! Starts an automatic checkpoint in a background thread, which releases the checkpoint lock when it is finished
+	void StartBackgroundCheckpoint(unique_ptr<StorageLockKey> checkpoint_lock);
+	void RunBackgroundCheckpoint();
 
 private:
 	//! The current start timestamp used by transactions
@@ -98,6 +111,12 @@ private:
 	StorageLock checkpoint_lock;
 	//! Lock necessary to start transactions only - used by FORCE CHECKPOINT to prevent new transactions from starting
 	mutex start_transaction_lock;
+	//! Whether or not a background checkpoint is running - only modified while holding the transaction lock
+	atomic<bool> background_checkpoint_running;
+	//! The exclusive checkpoint lock, handed to the background checkpoint
+	unique_ptr<StorageLockKey> background_checkpoint_lock;
+	//! The thread running the (last) background checkpoint
+	unique_ptr<thread> background_checkpoint_thread;
 
 protected:
 	virtual void OnCommitCheckpointDecision(const CheckpointDecision &decision, DuckTransaction &transaction) {
@@ -79,6 +79,7 @@ public:
 	LocalTableStorage &GetOrCreateStorage(ClientContext &context, DataTable &table);
 	idx_t EstimatedSize();
 	bool IsEmpty();
+	bool AppendsToIndexedTables();
 	void InsertEntry(DataTable &table, shared_ptr<LocalTableStorage> entry);
 
 private:
@@ -140,6 +141,8 @@ public:
 
 	bool ChangesMade() noexcept;
 	idx_t EstimatedSize();
+	//! Whether or not rows are appended to any table that has indexes
+	bool AppendsToIndexedTables();
 
 	bool Find(DataTable &table);
 
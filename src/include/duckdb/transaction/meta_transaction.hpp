@@ -55,7 +55,8 @@ public:
 	idx_t GetActiveQuery();
 	void SetActiveQuery(transaction_t query_number);
 
-	void ModifyDatabase(AttachedDatabase &db);
+	//! Marks the database as modified by this transaction. "only_appends" is set if the statement only appends rows
+	void ModifyDatabase(AttachedDatabase &db, bool only_appends = false);
 	optional_ptr<AttachedDatabase> ModifiedDatabase() {
 		return modified_database;
 	}
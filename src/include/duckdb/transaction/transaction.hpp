@@ -58,6 +58,8 @@ public:
 	DUCKDB_API bool IsReadOnly();
 	//! Promotes the transaction to a read-write transaction
 	DUCKDB_API virtual void SetReadWrite();
+	//! Called before a statement that can modify the existing data of the database (i.e., that does more than append)
+	DUCKDB_API virtual void ModifyExistingData();
 
 	virtual bool IsDuckTransaction() const {
 		return false;
@@ -46,7 +46,7 @@ public:
 	UndoBufferProperties GetProperties();
 
 	//! Cleanup the undo buffer
-	void Cleanup();
+	void Cleanup(transaction_t lowest_active_transaction, transaction_t commit_id);
 	//! Commit the changes made in the UndoBuffer: should be called on commit
 	void Commit(UndoBuffer::IteratorState &iterator_state, optional_ptr<WriteAheadLog> log, transaction_t commit_id);
 	//! Revert committed changes made in the UndoBuffer up until the currently committed state
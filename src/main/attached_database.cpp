@@ -150,6 +150,11 @@ void AttachedDatabase::Close() {
 	}
 	is_closed = true;
 
+	if (transaction_manager && transaction_manager->IsDuckTransactionManager()) {
+		// wait for a running background checkpoint before closing the storage
+		DuckTransactionManager::Get(*this).WaitForBackgroundCheckpoint();
+	}
+
 	if (!IsSystem() && !catalog->InMemory()) {
 		db.GetDatabaseManager().EraseDatabasePath(catalog->GetDBPath());
 	}
@@ -461,7 +461,7 @@ void ClientContext::CheckIfPreparedStatementIsExecutable(PreparedStatementData &
 			    "Cannot execute statement of type \"%s\" on database \"%s\" which is attached in read-only mode!",
 			    StatementTypeToString(statement.statement_type), modified_database));
 		}
-		meta_transaction.ModifyDatabase(*entry);
+		meta_transaction.ModifyDatabase(*entry, statement.properties.only_appends);
 	}
 }
 
@@ -1128,7 +1128,7 @@ void ClientContext::Append(TableDescription &description, ColumnDataCollection &
 		}
 		auto binder = Binder::CreateBinder(*this);
 		auto bound_constraints = binder->BindConstraints(table_entry);
-		MetaTransaction::Get(*this).ModifyDatabase(table_entry.ParentCatalog().GetAttached());
+		MetaTransaction::Get(*this).ModifyDatabase(table_entry.ParentCatalog().GetAttached(), true);
 		table_entry.GetStorage().LocalAppend(table_entry, *this, collection, bound_constraints);
 	});
 }
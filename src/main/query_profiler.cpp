@@ -102,6 +102,7 @@ bool QueryProfiler::OperatorRequiresProfiling(PhysicalOperatorType op_type) {
 	case PhysicalOperatorType::CROSS_PRODUCT:
 	case PhysicalOperatorType::PIECEWISE_MERGE_JOIN:
 	case PhysicalOperatorType::IE_JOIN:
+	case PhysicalOperatorType::INDEX_JOIN:
 	case PhysicalOperatorType::LEFT_DELIM_JOIN:
 	case PhysicalOperatorType::RIGHT_DELIM_JOIN:
 	case PhysicalOperatorType::UNION:
@@ -113,6 +114,15 @@ bool QueryProfiler::OperatorRequiresProfiling(PhysicalOperatorType op_type) {
 	}
 }
 
+bool QueryProfiler::OperatorReportsRuntimeInfo(PhysicalOperatorType op_type) {
+	switch (op_type) {
+	case PhysicalOperatorType::HASH_JOIN:
+		return true;
+	default:
+		return false;
+	}
+}
+
 void QueryProfiler::Finalize(TreeNode &node) {
 	for (auto &child : node.children) {
 		Finalize(*child);
@@ -133,6 +143,7 @@ void QueryProfiler::EndQuery() {
 	}
 
 	main_query.End();
+	UpdateRuntimeInfoInternal();
 	if (root) {
 		Finalize(*root);
 	}
@@ -307,6 +318,23 @@ void QueryProfiler::Flush(OperatorProfiler &profiler) {
 	profiler.timings.clear();
 }
 
+void QueryProfiler::UpdateRuntimeInfo() {
+	lock_guard<mutex> guard(flush_lock);
+	if (!IsEnabled() || !running) {
+		return;
+	}
+	UpdateRuntimeInfoInternal();
+}
+
+void QueryProfiler::UpdateRuntimeInfoInternal() {
+	for (auto &entry : tree_map) {
+		auto &op = entry.first.get();
+		if (OperatorReportsRuntimeInfo(op.type)) {
+			entry.second.get().extra_info = op.ParamsToString();
+		}
+	}
+}
+
 static string DrawPadded(const string &str, idx_t width) {
 	if (str.size() > width) {
 		return str.substr(0, width);
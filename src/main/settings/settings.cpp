@@ -78,6 +78,37 @@ Value AllowPersistentSecrets::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(config.secret_manager->PersistentSecretsEnabled());
 }
 
+//===--------------------------------------------------------------------===//
+// Background Checkpoint
+//===--------------------------------------------------------------------===//
+void BackgroundCheckpointSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.background_checkpoint = input.GetValue<bool>();
+}
+
+void BackgroundCheckpointSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.background_checkpoint = DBConfig().options.background_checkpoint;
+}
+
+Value BackgroundCheckpointSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.background_checkpoint);
+}
+
+//===--------------------------------------------------------------------===//
+// Bulk Update Threshold
+//===--------------------------------------------------------------------===//
+void BulkUpdateThresholdSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).bulk_update_threshold = ClientConfig().bulk_update_threshold;
+}
+
+void BulkUpdateThresholdSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).bulk_update_threshold = input.GetValue<uint64_t>();
+}
+
+Value BulkUpdateThresholdSetting::GetSetting(const ClientContext &context) {
+	return Value::UBIGINT(ClientConfig::GetConfig(context).bulk_update_threshold);
+}
+
 //===--------------------------------------------------------------------===//
 // Checkpoint Threshold
 //===--------------------------------------------------------------------===//
@@ -95,6 +126,22 @@ Value CheckpointThresholdSetting::GetSetting(const ClientContext &context) {
 	return Value(StringUtil::BytesToHumanReadableString(config.options.checkpoint_wal_size));
 }
 
+//===--------------------------------------------------------------------===//
+// Commit Delay
+//===--------------------------------------------------------------------===//
+void CommitDelaySetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.commit_delay = input.GetValue<uint64_t>();
+}
+
+void CommitDelaySetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.commit_delay = DBConfig().options.commit_delay;
+}
+
+Value CommitDelaySetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::UBIGINT(config.options.commit_delay);
+}
+
 //===--------------------------------------------------------------------===//
 // Debug Checkpoint Abort
 //===--------------------------------------------------------------------===//
@@ -938,6 +985,21 @@ Value ForceBitpackingModeSetting::GetSetting(const ClientContext &context) {
 	return Value(BitpackingModeToString(context.db->config.options.force_bitpacking_mode));
 }
 
+//===--------------------------------------------------------------------===//
+// Force Index Join
+//===--------------------------------------------------------------------===//
+void ForceIndexJoinSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).force_index_join = ClientConfig().force_index_join;
+}
+
+void ForceIndexJoinSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).force_index_join = input.GetValue<bool>();
+}
+
+Value ForceIndexJoinSetting::GetSetting(const ClientContext &context) {
+	return Value::BOOLEAN(ClientConfig::GetConfig(context).force_index_join);
+}
+
 //===--------------------------------------------------------------------===//
 // Home Directory
 //===--------------------------------------------------------------------===//
@@ -1003,6 +1065,21 @@ Value LogQueryPathSetting::GetSetting(const ClientContext &context) {
 	return client_data.log_query_writer ? Value(client_data.log_query_writer->path) : Value();
 }
 
+//===--------------------------------------------------------------------===//
+// Late Materialization Max Rows
+//===--------------------------------------------------------------------===//
+void LateMaterializationMaxRowsSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).late_materialization_max_rows = ClientConfig().late_materialization_max_rows;
+}
+
+void LateMaterializationMaxRowsSetting::SetLocal(ClientContext &context, const Value &input) {
+	ClientConfig::GetConfig(context).late_materialization_max_rows = input.GetValue<uint64_t>();
+}
+
+Value LateMaterializationMaxRowsSetting::GetSetting(const ClientContext &context) {
+	return Value::UBIGINT(ClientConfig::GetConfig(context).late_materialization_max_rows);
+}
+
 //===--------------------------------------------------------------------===//
 // Lock Configuration
 //===--------------------------------------------------------------------===//
@@ -1115,6 +1192,48 @@ Value MaximumTempDirectorySize::GetSetting(const ClientContext &context) {
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// Maximum Query Threads
+//===--------------------------------------------------------------------===//
+void MaximumQueryThreadsSetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).max_query_threads = ClientConfig().max_query_threads;
+}
+
+void MaximumQueryThreadsSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto max_threads = input.GetValue<int64_t>();
+	if (max_threads < 0) {
+		throw ParserException("max_query_threads must be >= 0 (0 = no limit)");
+	}
+	ClientConfig::GetConfig(context).max_query_threads = NumericCast<idx_t>(max_threads);
+}
+
+Value MaximumQueryThreadsSetting::GetSetting(const ClientContext &context) {
+	return Value::BIGINT(NumericCast<int64_t>(ClientConfig::GetConfig(context).max_query_threads));
+}
+
+//===--------------------------------------------------------------------===//
+// NUMA Bind Queries
+//===--------------------------------------------------------------------===//
+void NumaBindQueriesSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.numa_bind_queries = input.GetValue<bool>();
+	if (db) {
+		// the threads read this setting when they are launched
+		TaskScheduler::GetScheduler(*db).RequireRelaunch();
+	}
+}
+
+void NumaBindQueriesSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.numa_bind_queries = DBConfig().options.numa_bind_queries;
+	if (db) {
+		TaskScheduler::GetScheduler(*db).RequireRelaunch();
+	}
+}
+
+Value NumaBindQueriesSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.numa_bind_queries);
+}
+
 //===--------------------------------------------------------------------===//
 // Old Implicit Casting
 //===--------------------------------------------------------------------===//
@@ -1147,6 +1266,48 @@ Value PartitionedWriteFlushThreshold::GetSetting(const ClientContext &context) {
 	return Value::BIGINT(NumericCast<int64_t>(ClientConfig::GetConfig(context).partitioned_write_flush_threshold));
 }
 
+//===--------------------------------------------------------------------===//
+// Pin Threads
+//===--------------------------------------------------------------------===//
+void PinThreadsSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto parameter = StringUtil::Lower(input.ToString());
+	if (parameter == "on") {
+		config.options.pin_threads = ThreadPinMode::ON;
+	} else if (parameter == "off") {
+		config.options.pin_threads = ThreadPinMode::OFF;
+	} else if (parameter == "auto") {
+		config.options.pin_threads = ThreadPinMode::AUTO;
+	} else {
+		throw InvalidInputException("Unrecognized parameter for option PIN_THREADS \"%s\". Expected ON, OFF or AUTO.",
+		                            parameter);
+	}
+	if (db) {
+		// the threads are pinned when they are launched
+		TaskScheduler::GetScheduler(*db).RequireRelaunch();
+	}
+}
+
+void PinThreadsSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.pin_threads = DBConfig().options.pin_threads;
+	if (db) {
+		TaskScheduler::GetScheduler(*db).RequireRelaunch();
+	}
+}
+
+Value PinThreadsSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	switch (config.options.pin_threads) {
+	case ThreadPinMode::ON:
+		return "on";
+	case ThreadPinMode::OFF:
+		return "off";
+	case ThreadPinMode::AUTO:
+		return "auto";
+	default:
+		throw InternalException("Unknown thread pin mode setting");
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Password Setting
 //===--------------------------------------------------------------------===//
@@ -1333,6 +1494,41 @@ Value ProgressBarTimeSetting::GetSetting(const ClientContext &context) {
 	return Value::BIGINT(ClientConfig::GetConfig(context).wait_time);
 }
 
+//===--------------------------------------------------------------------===//
+// Query Priority
+//===--------------------------------------------------------------------===//
+void QueryPrioritySetting::ResetLocal(ClientContext &context) {
+	ClientConfig::GetConfig(context).query_priority = ClientConfig().query_priority;
+}
+
+void QueryPrioritySetting::SetLocal(ClientContext &context, const Value &input) {
+	auto parameter = StringUtil::Lower(input.ToString());
+	auto &config = ClientConfig::GetConfig(context);
+	if (parameter == "low") {
+		config.query_priority = TaskPriority::LOW;
+	} else if (parameter == "normal") {
+		config.query_priority = TaskPriority::NORMAL;
+	} else if (parameter == "high") {
+		config.query_priority = TaskPriority::HIGH;
+	} else {
+		throw ParserException("Unrecognized query priority \"%s\", supported priorities: [low, normal, high]",
+		                      parameter);
+	}
+}
+
+Value QueryPrioritySetting::GetSetting(const ClientContext &context) {
+	switch (ClientConfig::GetConfig(context).query_priority) {
+	case TaskPriority::LOW:
+		return Value("low");
+	case TaskPriority::NORMAL:
+		return Value("normal");
+	case TaskPriority::HIGH:
+		return Value("high");
+	default:
+		throw InternalException("Unrecognized query priority");
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Schema
 //===--------------------------------------------------------------------===//
@@ -1417,6 +1613,37 @@ Value TempDirectorySetting::GetSetting(const ClientContext &context) {
 	return Value(buffer_manager.GetTemporaryDirectory());
 }
 
+//===--------------------------------------------------------------------===//
+// Temp File Compression
+//===--------------------------------------------------------------------===//
+void TempFileCompressionSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto parameter = StringUtil::Lower(input.ToString());
+	if (parameter == "none") {
+		config.options.temp_file_compression = TemporaryFileCompression::NONE;
+	} else if (parameter == "lz4") {
+		config.options.temp_file_compression = TemporaryFileCompression::LZ4;
+	} else {
+		throw InvalidInputException(
+		    "Unrecognized parameter for option TEMP_FILE_COMPRESSION \"%s\". Expected NONE or LZ4.", parameter);
+	}
+}
+
+void TempFileCompressionSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.temp_file_compression = DBConfig().options.temp_file_compression;
+}
+
+Value TempFileCompressionSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	switch (config.options.temp_file_compression) {
+	case TemporaryFileCompression::NONE:
+		return "none";
+	case TemporaryFileCompression::LZ4:
+		return "lz4";
+	default:
+		throw InternalException("Unknown temp file compression setting");
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Threads Setting
 //===--------------------------------------------------------------------===//
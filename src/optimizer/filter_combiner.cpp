@@ -1,5 +1,8 @@
 #include "duckdb/optimizer/filter_combiner.hpp"
 
+#include "duckdb/common/enums/date_part_specifier.hpp"
+#include "duckdb/common/types/interval.hpp"
+#include "duckdb/common/types/timestamp.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/planner/expression.hpp"
 #include "duckdb/planner/expression/bound_between_expression.hpp"
@@ -435,6 +438,150 @@ static unique_ptr<TableFilter> PushDownFilterIntoExpr(const Expression &expr, un
 	return inner_filter;
 }
 
+//! Returns the interval that is always larger than the distance between a timestamp and its truncation to the part
+static bool TryGetDateTruncUnit(DatePartSpecifier part, interval_t &result) {
+	switch (part) {
+	case DatePartSpecifier::MILLENNIUM:
+		result = interval_t {12000, 0, 0};
+		return true;
+	case DatePartSpecifier::CENTURY:
+		result = interval_t {1200, 0, 0};
+		return true;
+	case DatePartSpecifier::DECADE:
+		result = interval_t {120, 0, 0};
+		return true;
+	case DatePartSpecifier::YEAR:
+		result = interval_t {12, 0, 0};
+		return true;
+	case DatePartSpecifier::QUARTER:
+		result = interval_t {3, 0, 0};
+		return true;
+	case DatePartSpecifier::MONTH:
+		result = interval_t {1, 0, 0};
+		return true;
+	case DatePartSpecifier::WEEK:
+		result = interval_t {0, 7, 0};
+		return true;
+	case DatePartSpecifier::DAY:
+		result = interval_t {0, 1, 0};
+		return true;
+	case DatePartSpecifier::HOUR:
+		result = Interval::FromMicro(Interval::MICROS_PER_HOUR);
+		return true;
+	case DatePartSpecifier::MINUTE:
+		result = Interval::FromMicro(Interval::MICROS_PER_MINUTE);
+		return true;
+	case DatePartSpecifier::SECOND:
+		result = Interval::FromMicro(Interval::MICROS_PER_SEC);
+		return true;
+	case DatePartSpecifier::MILLISECONDS:
+		result = Interval::FromMicro(Interval::MICROS_PER_MSEC);
+		return true;
+	case DatePartSpecifier::MICROSECONDS:
+		result = Interval::FromMicro(1);
+		return true;
+	default:
+		return false;
+	}
+}
+
+//! Pushes the bounds on a timestamp column that are implied by comparisons of date_trunc(part, column) with constants.
+//! As date_trunc(part, x) <= x < date_trunc(part, x) + 1 part, e.g., [date_trunc('day', x) = '2000-01-01'] implies
+//! [x >= '2000-01-01' AND x < '2000-01-02']. These bounds allow the zonemaps of the column to prune row groups, the
+//! comparison itself is still evaluated afterwards
+static void GenerateDateTruncFilters(const vector<idx_t> &column_ids, const Expression &expr,
+                                     const vector<ExpressionValueInformation> &constant_list,
+                                     TableFilterSet &table_filters) {
+	if (expr.type != ExpressionType::BOUND_FUNCTION) {
+		return;
+	}
+	auto &func = expr.Cast<BoundFunctionExpression>();
+	if (func.function.name != "date_trunc" || func.children.size() != 2 ||
+	    func.children[0]->type != ExpressionType::VALUE_CONSTANT ||
+	    func.children[1]->type != ExpressionType::BOUND_COLUMN_REF ||
+	    func.children[1]->return_type.id() != LogicalTypeId::TIMESTAMP) {
+		return;
+	}
+	auto &part_value = func.children[0]->Cast<BoundConstantExpression>().value;
+	if (part_value.IsNull()) {
+		return;
+	}
+	DatePartSpecifier part;
+	if (!TryGetDatePartSpecifier(StringValue::Get(part_value), part)) {
+		return;
+	}
+	auto column_index = column_ids[func.children[1]->Cast<BoundColumnRefExpression>().binding.column_index];
+	if (column_index == COLUMN_IDENTIFIER_ROW_ID) {
+		return;
+	}
+	interval_t unit;
+	bool has_unit = TryGetDateTruncUnit(part, unit);
+	for (auto &constant_cmp : constant_list) {
+		auto &constant = constant_cmp.constant;
+		if (constant.IsNull() || (constant.type().id() != LogicalTypeId::TIMESTAMP &&
+		                          constant.type().id() != LogicalTypeId::DATE)) {
+			continue;
+		}
+		auto timestamp_value = constant.DefaultCastAs(LogicalType::TIMESTAMP);
+		auto timestamp = TimestampValue::Get(timestamp_value);
+		switch (constant_cmp.comparison_type) {
+		case ExpressionType::COMPARE_GREATERTHAN:
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		case ExpressionType::COMPARE_EQUAL:
+			// x >= date_trunc(part, x) >= constant
+			table_filters.PushFilter(column_index,
+			                         make_uniq<ConstantFilter>(constant_cmp.comparison_type ==
+			                                                           ExpressionType::COMPARE_GREATERTHAN
+			                                                       ? ExpressionType::COMPARE_GREATERTHAN
+			                                                       : ExpressionType::COMPARE_GREATERTHANOREQUALTO,
+			                                                   timestamp_value));
+			break;
+		default:
+			break;
+		}
+		switch (constant_cmp.comparison_type) {
+		case ExpressionType::COMPARE_LESSTHAN:
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		case ExpressionType::COMPARE_EQUAL: {
+			// x < date_trunc(part, x) + 1 part <= constant + 1 part
+			if (!has_unit || !Timestamp::IsFinite(timestamp)) {
+				break;
+			}
+			timestamp_t upper_bound;
+			try {
+				upper_bound = Interval::Add(timestamp, unit);
+			} catch (OutOfRangeException &) {
+				break;
+			}
+			table_filters.PushFilter(column_index, make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHAN,
+			                                                                 Value::TIMESTAMP(upper_bound)));
+			break;
+		}
+		default:
+			break;
+		}
+	}
+	table_filters.PushFilter(column_index, make_uniq<IsNotNullFilter>());
+}
+
+//! Whether or not the zonemaps of a column of the given type can be checked against a range of constants
+static bool CanPruneInRange(const LogicalType &type) {
+	switch (type.id()) {
+	case LogicalTypeId::DECIMAL:
+	case LogicalTypeId::VARCHAR:
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::TIME:
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_SEC:
+	case LogicalTypeId::TIMESTAMP_MS:
+	case LogicalTypeId::TIMESTAMP_NS:
+	case LogicalTypeId::TIMESTAMP_TZ:
+		return true;
+	default:
+		return type.IsIntegral();
+	}
+}
+
 TableFilterSet FilterCombiner::GenerateTableScanFilters(vector<idx_t> &column_ids) {
 	TableFilterSet table_filters;
 	//! First, we figure the filters that have constant expressions that we can push down to the table scan
@@ -463,6 +610,8 @@ TableFilterSet FilterCombiner::GenerateTableScanFilters(vector<idx_t> &column_id
 				// struct_extract call
 				idx_t column_index;
 				if (!TryGetBoundColumnIndex(column_ids, expr, column_index)) {
+					// the comparison is not on a column, but can still imply bounds on a column
+					GenerateDateTruncFilters(column_ids, expr, constant_value.second, table_filters);
 					continue;
 				}
 				if (column_index == COLUMN_IDENTIFIER_ROW_ID) {
@@ -568,26 +717,41 @@ TableFilterSet FilterCombiner::GenerateTableScanFilters(vector<idx_t> &column_id
 			}
 			auto &fst_const_value_expr = func.children[1]->Cast<BoundConstantExpression>();
 			auto &type = fst_const_value_expr.value.type();
-
-			//! Check if values are consecutive, if yes transform them to >= <= (only for integers)
-			// e.g. if we have x IN (1, 2, 3, 4, 5) we transform this into x >= 1 AND x <= 5
-			if (!type.IsIntegral()) {
+			if (!CanPruneInRange(type) || type != column_ref.return_type) {
 				continue;
 			}
 
-			bool can_simplify_in_clause = true;
+			// find the range of the values
+			bool has_null = false;
+			Value min_value = fst_const_value_expr.value;
+			Value max_value = fst_const_value_expr.value;
 			for (idx_t i = 1; i < func.children.size(); i++) {
 				auto &const_value_expr = func.children[i]->Cast<BoundConstantExpression>();
 				if (const_value_expr.value.IsNull()) {
-					can_simplify_in_clause = false;
+					has_null = true;
 					break;
 				}
-				in_values.push_back(const_value_expr.value.GetValue<hugeint_t>());
+				if (const_value_expr.value < min_value) {
+					min_value = const_value_expr.value;
+				}
+				if (const_value_expr.value > max_value) {
+					max_value = const_value_expr.value;
+				}
 			}
-			if (!can_simplify_in_clause || in_values.empty()) {
+			if (has_null) {
 				continue;
 			}
 
+			//! Check if values are consecutive, if yes transform them to >= <= (only for integers)
+			// e.g. if we have x IN (1, 2, 3, 4, 5) we transform this into x >= 1 AND x <= 5
+			bool can_simplify_in_clause = type.IsIntegral();
+			if (can_simplify_in_clause) {
+				for (idx_t i = 1; i < func.children.size(); i++) {
+					auto &const_value_expr = func.children[i]->Cast<BoundConstantExpression>();
+					in_values.push_back(const_value_expr.value.GetValue<hugeint_t>());
+				}
+			}
+
 			sort(in_values.begin(), in_values.end());
 
 			for (idx_t in_val_idx = 1; in_val_idx < in_values.size(); in_val_idx++) {
@@ -597,6 +761,13 @@ TableFilterSet FilterCombiner::GenerateTableScanFilters(vector<idx_t> &column_id
 				}
 			}
 			if (!can_simplify_in_clause) {
+				// the values are not consecutive: the IN clause is still evaluated on the rows, but the zonemaps of
+				// the column can be checked against the range of the values
+				table_filters.PushFilter(
+				    column_index, make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO, min_value));
+				table_filters.PushFilter(
+				    column_index, make_uniq<ConstantFilter>(ExpressionType::COMPARE_LESSTHANOREQUALTO, max_value));
+				table_filters.PushFilter(column_index, make_uniq<IsNotNullFilter>());
 				continue;
 			}
 			auto lower_bound = make_uniq<ConstantFilter>(ExpressionType::COMPARE_GREATERTHANOREQUALTO,
@@ -356,7 +356,8 @@ void Executor::InitializeInternal(PhysicalOperator &plan) {
 
 		this->profiler = ClientData::Get(context).profiler;
 		profiler->Initialize(plan);
-		this->producer = scheduler.CreateProducer();
+		auto &client_config = ClientConfig::GetConfig(context);
+		this->producer = scheduler.CreateProducer(client_config.query_priority, client_config.max_query_threads);
 
 		// build and ready the pipelines
 		PipelineBuildState state;
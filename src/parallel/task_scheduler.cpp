@@ -1,8 +1,11 @@
 #include "duckdb/parallel/task_scheduler.hpp"
 
 #include "duckdb/common/chrono.hpp"
+#include "duckdb/common/deque.hpp"
 #include "duckdb/common/exception.hpp"
+#include "duckdb/common/file_system.hpp"
 #include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/common/string_util.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
 
@@ -16,6 +19,12 @@
 #include <queue>
 #endif
 
+#if defined(__linux__) && !defined(__ANDROID__) && !defined(DUCKDB_NO_THREADS)
+#define DUCKDB_PIN_THREADS
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 namespace duckdb {
 
 struct SchedulerThread {
@@ -31,12 +40,101 @@ struct SchedulerThread {
 #endif
 };
 
+//===--------------------------------------------------------------------===//
+// ProducerState
+//===--------------------------------------------------------------------===//
+//! The scheduling state of a producer, it is shared with its scheduled tasks so it outlives the producer token
+struct ProducerState {
+	ProducerState(TaskPriority priority, idx_t max_threads)
+	    : priority(priority), max_threads(max_threads), active_threads(0) {
+	}
+
+	const TaskPriority priority;
+	//! The maximum number of background threads that execute tasks of this producer at the same time (0 = no limit)
+	const idx_t max_threads;
+
+	mutex lock;
+	//! The number of background threads that are executing tasks of this producer
+	idx_t active_threads;
+	//! Tasks that were dequeued while `max_threads` threads were already executing tasks of this producer
+	deque<shared_ptr<Task>> parked_tasks;
+
+public:
+	//! Returns true if the thread may execute the task, otherwise the task is parked until a thread finishes a task
+	bool StartTask(shared_ptr<Task> &task) {
+		if (max_threads == 0) {
+			return true;
+		}
+		lock_guard<mutex> guard(lock);
+		if (active_threads < max_threads) {
+			active_threads++;
+			return true;
+		}
+		parked_tasks.push_back(std::move(task));
+		return false;
+	}
+	//! Called when a thread finished a task, returns true if the thread continues with a parked task
+	bool FinishTask(shared_ptr<Task> &task) {
+		if (max_threads == 0) {
+			return false;
+		}
+		lock_guard<mutex> guard(lock);
+		if (!parked_tasks.empty()) {
+			task = std::move(parked_tasks.front());
+			parked_tasks.pop_front();
+			return true;
+		}
+		D_ASSERT(active_threads > 0);
+		active_threads--;
+		return false;
+	}
+	//! Takes a parked task, the thread that runs the query is not limited by `max_threads`
+	bool TakeParkedTask(shared_ptr<Task> &task) {
+		if (max_threads == 0) {
+			return false;
+		}
+		lock_guard<mutex> guard(lock);
+		if (parked_tasks.empty()) {
+			return false;
+		}
+		task = std::move(parked_tasks.front());
+		parked_tasks.pop_front();
+		return true;
+	}
+};
+
+//! A task in the queue, together with the state of its producer
+struct ScheduledTask {
+	ScheduledTask() {
+	}
+	ScheduledTask(shared_ptr<Task> task_p, shared_ptr<ProducerState> state_p)
+	    : task(std::move(task_p)), state(std::move(state_p)) {
+	}
+
+	shared_ptr<Task> task;
+	shared_ptr<ProducerState> state;
+};
+
 #ifndef DUCKDB_NO_THREADS
-typedef duckdb_moodycamel::ConcurrentQueue<shared_ptr<Task>> concurrent_queue_t;
+//! The weighted round-robin order in which the threads visit the priority classes (high: 4, normal: 2, low: 1)
+static constexpr const TaskPriority PRIORITY_SCHEDULE[] = {TaskPriority::HIGH, TaskPriority::NORMAL,
+                                                           TaskPriority::HIGH, TaskPriority::LOW,
+                                                           TaskPriority::HIGH, TaskPriority::NORMAL,
+                                                           TaskPriority::HIGH};
+static constexpr const idx_t PRIORITY_SCHEDULE_SIZE = sizeof(PRIORITY_SCHEDULE) / sizeof(TaskPriority);
+
+struct TaskQueueTraits : public duckdb_moodycamel::ConcurrentQueueDefaultTraits {
+	//! Consumers rotate to the next producer after every task, so the queries of a priority class share the threads
+	//! equally, instead of the query with the most tasks getting most of them
+	static const std::uint32_t EXPLICIT_CONSUMER_CONSUMPTION_QUOTA_BEFORE_ROTATE = 1;
+};
+
+typedef duckdb_moodycamel::ConcurrentQueue<ScheduledTask, TaskQueueTraits> concurrent_queue_t;
 typedef duckdb_moodycamel::LightweightSemaphore lightweight_semaphore_t;
 
 struct ConcurrentQueue {
-	concurrent_queue_t q;
+	//! One queue per priority class
+	concurrent_queue_t q[TASK_PRIORITY_COUNT];
 	lightweight_semaphore_t semaphore;
 
 	void Enqueue(ProducerToken &token, shared_ptr<Task> task);
@@ -44,15 +142,40 @@ struct ConcurrentQueue {
 };
 
 struct QueueProducerToken {
-	explicit QueueProducerToken(ConcurrentQueue &queue) : queue_token(queue.q) {
+	QueueProducerToken(ConcurrentQueue &queue, idx_t node, shared_ptr<ProducerState> state_p)
+	    : queue_token(queue.q[static_cast<idx_t>(state_p->priority)]), node(node), state(std::move(state_p)) {
 	}
 
 	duckdb_moodycamel::ProducerToken queue_token;
+	//! The NUMA node of the queue that the tasks of this producer are scheduled in
+	idx_t node;
+	shared_ptr<ProducerState> state;
+};
+
+//! The consumer tokens of a thread, one for every queue
+struct TaskConsumer {
+	explicit TaskConsumer(vector<unique_ptr<ConcurrentQueue>> &queues) : tick(0) {
+		for (auto &queue : queues) {
+			for (idx_t priority = 0; priority < TASK_PRIORITY_COUNT; priority++) {
+				tokens.push_back(make_uniq<duckdb_moodycamel::ConsumerToken>(queue->q[priority]));
+			}
+		}
+	}
+
+	duckdb_moodycamel::ConsumerToken &GetToken(idx_t node, idx_t priority) {
+		return *tokens[node * TASK_PRIORITY_COUNT + priority];
+	}
+
+	//! The position of the thread in the PRIORITY_SCHEDULE
+	idx_t tick;
+	vector<unique_ptr<duckdb_moodycamel::ConsumerToken>> tokens;
 };
 
 void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
 	lock_guard<mutex> producer_lock(token.producer_lock);
-	if (q.enqueue(token.token->queue_token, std::move(task))) {
+	auto &state = token.token->state;
+	if (q[static_cast<idx_t>(state->priority)].enqueue(token.token->queue_token,
+	                                                   ScheduledTask(std::move(task), state))) {
 		semaphore.signal();
 	} else {
 		throw InternalException("Could not schedule task!");
@@ -61,7 +184,13 @@ void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
 
 bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
 	lock_guard<mutex> producer_lock(token.producer_lock);
-	return q.try_dequeue_from_producer(token.token->queue_token, task);
+	ScheduledTask scheduled_task;
+	if (!q[static_cast<idx_t>(token.token->state->priority)].try_dequeue_from_producer(token.token->queue_token,
+	                                                                                   scheduled_task)) {
+		return false;
+	}
+	task = std::move(scheduled_task.task);
+	return true;
 }
 
 #else
@@ -89,9 +218,158 @@ bool ConcurrentQueue::DequeueFromProducer(ProducerToken &token, shared_ptr<Task>
 }
 
 struct QueueProducerToken {
-	QueueProducerToken(ConcurrentQueue &queue) {
+	QueueProducerToken(ConcurrentQueue &queue, idx_t node, shared_ptr<ProducerState> state_p)
+	    : node(node), state(std::move(state_p)) {
 	}
+
+	idx_t node;
+	shared_ptr<ProducerState> state;
 };
+
+struct TaskConsumer {};
+#endif
+
+//===--------------------------------------------------------------------===//
+// NumaTopology
+//===--------------------------------------------------------------------===//
+struct NumaTopology {
+	//! The CPUs of every NUMA node that this process is allowed to run on
+	vector<vector<idx_t>> node_cpus;
+	//! For every node, the other nodes ordered by their distance to it (the order in which we steal tasks)
+	vector<vector<idx_t>> steal_order;
+
+	idx_t NodeCount() const {
+		return node_cpus.size();
+	}
+
+	static unique_ptr<NumaTopology> Detect();
+
+private:
+	static bool TryReadFile(FileSystem &fs, const string &path, string &result);
+	static vector<idx_t> ParseCPUList(const string &cpu_list);
+};
+
+bool NumaTopology::TryReadFile(FileSystem &fs, const string &path, string &result) {
+	try {
+		if (!fs.FileExists(path)) {
+			return false;
+		}
+		auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ);
+		char buffer[4096];
+		auto read_bytes = fs.Read(*handle, buffer, sizeof(buffer) - 1);
+		buffer[read_bytes] = '\0';
+		result = StringUtil::Replace(string(buffer), "\n", "");
+		return true;
+	} catch (std::exception &) {
+		return false;
+	}
+}
+
+//! Parses a list of CPUs in the format of the Linux sysfs, e.g., "0-31,64-95"
+vector<idx_t> NumaTopology::ParseCPUList(const string &cpu_list) {
+	vector<idx_t> result;
+	for (auto &range : StringUtil::Split(cpu_list, ",")) {
+		auto bounds = StringUtil::Split(range, "-");
+		if (bounds.empty() || bounds.size() > 2) {
+			return vector<idx_t>();
+		}
+		auto begin = std::stoull(bounds[0]);
+		auto end = bounds.size() == 2 ? std::stoull(bounds[1]) : begin;
+		for (auto cpu = begin; cpu <= end; cpu++) {
+			result.push_back(cpu);
+		}
+	}
+	return result;
+}
+
+unique_ptr<NumaTopology> NumaTopology::Detect() {
+	auto result = make_uniq<NumaTopology>();
+#ifdef DUCKDB_PIN_THREADS
+	cpu_set_t allowed_cpus;
+	CPU_ZERO(&allowed_cpus);
+	auto has_affinity = sched_getaffinity(0, sizeof(cpu_set_t), &allowed_cpus) == 0;
+
+	auto fs = FileSystem::CreateLocal();
+	vector<string> distances;
+	try {
+		for (idx_t node = 0;; node++) {
+			auto node_path = "/sys/devices/system/node/node" + to_string(node);
+			string cpu_list, distance;
+			if (!TryReadFile(*fs, node_path + "/cpulist", cpu_list)) {
+				break;
+			}
+			vector<idx_t> cpus;
+			for (auto &cpu : ParseCPUList(cpu_list)) {
+				if (cpu < CPU_SETSIZE && (!has_affinity || CPU_ISSET(cpu, &allowed_cpus))) {
+					cpus.push_back(cpu);
+				}
+			}
+			if (cpus.empty()) {
+				// memory-only node, or a node we are not allowed to run on
+				continue;
+			}
+			TryReadFile(*fs, node_path + "/distance", distance);
+			result->node_cpus.push_back(std::move(cpus));
+			distances.push_back(std::move(distance));
+		}
+	} catch (std::exception &) {
+		result->node_cpus.clear();
+	}
+	if (result->node_cpus.size() > 1) {
+		for (idx_t node = 0; node < result->NodeCount(); node++) {
+			// "distance" lists the distance to all nodes (including the ones we skipped), in order of node id
+			// we only use it to order the nodes, so we fall back to the node id if it can not be parsed
+			auto node_distances = StringUtil::Split(distances[node], " ");
+			vector<std::pair<idx_t, idx_t>> order;
+			for (idx_t other = 0; other < result->NodeCount(); other++) {
+				if (other == node) {
+					continue;
+				}
+				idx_t distance = other;
+				if (node_distances.size() == result->NodeCount()) {
+					try {
+						distance = std::stoull(node_distances[other]);
+					} catch (std::exception &) {
+					}
+				}
+				order.emplace_back(distance, other);
+			}
+			std::sort(order.begin(), order.end());
+			vector<idx_t> steal_order;
+			for (auto &entry : order) {
+				steal_order.push_back(entry.second);
+			}
+			result->steal_order.push_back(std::move(steal_order));
+		}
+		return result;
+	}
+	// a single node (or the nodes could not be detected): threads are pinned to the CPUs we are allowed to run on
+	vector<idx_t> cpus;
+	for (idx_t cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+		if (has_affinity ? CPU_ISSET(cpu, &allowed_cpus) : cpu < std::thread::hardware_concurrency()) {
+			cpus.push_back(cpu);
+		}
+	}
+	result->node_cpus.clear();
+	result->node_cpus.push_back(std::move(cpus));
+	result->steal_order.emplace_back();
+	return result;
+#else
+	// threads cannot be pinned on this platform
+	result->node_cpus.emplace_back();
+	result->steal_order.emplace_back();
+	return result;
+#endif
+}
+
+#ifdef DUCKDB_PIN_THREADS
+static void PinThread(thread &worker_thread, idx_t cpu) {
+	cpu_set_t cpuset;
+	CPU_ZERO(&cpuset);
+	CPU_SET(cpu, &cpuset);
+	// failing to pin a thread is not an error, the thread just runs on any CPU
+	pthread_setaffinity_np(worker_thread.native_handle(), sizeof(cpu_set_t), &cpuset);
+}
 #endif
 
 ProducerToken::ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token)
@@ -102,9 +380,12 @@ ProducerToken::~ProducerToken() {
 }
 
 TaskScheduler::TaskScheduler(DatabaseInstance &db)
-    : db(db), queue(make_uniq<ConcurrentQueue>()),
+    : db(db), topology(NumaTopology::Detect()), active_node_count(1), next_producer_node(0), relaunch_required(false),
       allocator_flush_threshold(db.config.options.allocator_flush_threshold), requested_thread_count(0),
       current_thread_count(1) {
+	for (idx_t node = 0; node < topology->NodeCount(); node++) {
+		queues.push_back(make_uniq<ConcurrentQueue>());
+	}
 }
 
 TaskScheduler::~TaskScheduler() {
@@ -126,60 +407,83 @@ TaskScheduler &TaskScheduler::GetScheduler(DatabaseInstance &db) {
 }
 
 unique_ptr<ProducerToken> TaskScheduler::CreateProducer() {
-	auto token = make_uniq<QueueProducerToken>(*queue);
+	return CreateProducer(TaskPriority::NORMAL, 0);
+}
+
+unique_ptr<ProducerToken> TaskScheduler::CreateProducer(TaskPriority priority, idx_t max_threads) {
+	// the tasks of a producer (i.e., of a query) are scheduled on a single NUMA node, so the data they allocate
+	// (first touch) is local to the threads that are most likely to process it
+	auto node = next_producer_node++ % active_node_count.load();
+	auto state = make_shared_ptr<ProducerState>(priority, max_threads);
+	auto token = make_uniq<QueueProducerToken>(*queues[node], node, std::move(state));
 	return make_uniq<ProducerToken>(*this, std::move(token));
 }
 
 void TaskScheduler::ScheduleTask(ProducerToken &token, shared_ptr<Task> task) {
 	// Enqueue a task for the given producer token and signal any sleeping threads
-	queue->Enqueue(token, std::move(task));
+	queues[token.token->node]->Enqueue(token, std::move(task));
 }
 
 bool TaskScheduler::GetTaskFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
-	return queue->DequeueFromProducer(token, task);
+	if (queues[token.token->node]->DequeueFromProducer(token, task)) {
+		return true;
+	}
+	return token.token->state->TakeParkedTask(task);
 }
 
-void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 #ifndef DUCKDB_NO_THREADS
-	shared_ptr<Task> task;
-	// loop until the marker is set to false
-	while (*marker) {
-		// wait for a signal with a timeout
-		queue->semaphore.wait();
-		if (queue->q.try_dequeue(task)) {
-			auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
-
-			switch (execute_result) {
-			case TaskExecutionResult::TASK_FINISHED:
-			case TaskExecutionResult::TASK_ERROR:
-				task.reset();
-				break;
-			case TaskExecutionResult::TASK_NOT_FINISHED:
-				throw InternalException("Task should not return TASK_NOT_FINISHED in PROCESS_ALL mode");
-			case TaskExecutionResult::TASK_BLOCKED:
-				task->Deschedule();
-				task.reset();
-				break;
-			}
+//! Dequeues a task from the queues of a node, starting with the preferred priority class
+//! The other classes are tried as well (highest priority first), so no thread idles while there are tasks
+static bool DequeueFromNode(ConcurrentQueue &queue, TaskConsumer &consumer, idx_t node, TaskPriority preferred,
+                            ScheduledTask &task) {
+	auto preferred_idx = static_cast<idx_t>(preferred);
+	if (queue.q[preferred_idx].try_dequeue(consumer.GetToken(node, preferred_idx), task)) {
+		return true;
+	}
+	for (idx_t priority_idx = TASK_PRIORITY_COUNT; priority_idx > 0; priority_idx--) {
+		auto priority = priority_idx - 1;
+		if (priority != preferred_idx && queue.q[priority].try_dequeue(consumer.GetToken(node, priority), task)) {
+			return true;
+		}
+	}
+	return false;
+}
+#endif
 
-			// Flushes the outstanding allocator's outstanding allocations
-			Allocator::ThreadFlush(allocator_flush_threshold);
+bool TaskScheduler::DequeueTask(TaskConsumer &consumer, idx_t node, bool steal, ScheduledTask &task) {
+#ifndef DUCKDB_NO_THREADS
+	auto preferred = PRIORITY_SCHEDULE[consumer.tick++ % PRIORITY_SCHEDULE_SIZE];
+	if (DequeueFromNode(*queues[node], consumer, node, preferred, task)) {
+		return true;
+	}
+	if (!steal) {
+		return false;
+	}
+	for (auto &other : topology->steal_order[node]) {
+		if (DequeueFromNode(*queues[other], consumer, other, preferred, task)) {
+			return true;
 		}
 	}
-#else
-	throw NotImplementedException("DuckDB was compiled without threads! Background thread loop is not allowed.");
 #endif
+	return false;
 }
 
-idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
-#ifndef DUCKDB_NO_THREADS
-	idx_t completed_tasks = 0;
-	// loop until the marker is set to false
-	while (*marker && completed_tasks < max_tasks) {
-		shared_ptr<Task> task;
-		if (!queue->q.try_dequeue(task)) {
-			return completed_tasks;
+bool TaskScheduler::DequeueRunnableTask(TaskConsumer &consumer, idx_t node, bool steal, ScheduledTask &task) {
+	while (DequeueTask(consumer, node, steal, task)) {
+		if (task.state->StartTask(task.task)) {
+			return true;
 		}
+		// the producer has reached its thread limit: the task is parked and will be executed by one of its threads
+	}
+	return false;
+}
+
+idx_t TaskScheduler::ExecuteScheduledTask(ScheduledTask &scheduled_task) {
+	// keep the state alive, the producer can be destroyed as soon as its last task has finished
+	auto state = std::move(scheduled_task.state);
+	auto task = std::move(scheduled_task.task);
+	idx_t completed_tasks = 0;
+	do {
 		auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
 
 		switch (execute_result) {
@@ -195,6 +499,50 @@ idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 			task.reset();
 			break;
 		}
+	} while (state->FinishTask(task));
+	return completed_tasks;
+}
+
+void TaskScheduler::ExecuteForever(atomic<bool> *marker, idx_t node) {
+#ifndef DUCKDB_NO_THREADS
+	D_ASSERT(node < queues.size());
+	auto &queue = queues[node];
+	// with multiple NUMA nodes, we periodically wake up to steal tasks from the other nodes, unless the tasks of a
+	// query are bound to the node of the query
+	const bool steal = queues.size() > 1 && !DBConfig::GetConfig(db).options.numa_bind_queries;
+	TaskConsumer consumer(queues);
+	ScheduledTask task;
+	// loop until the marker is set to false
+	while (*marker) {
+		// wait for a signal with a timeout
+		if (steal) {
+			queue->semaphore.wait(TASK_TIMEOUT_USECS);
+		} else {
+			queue->semaphore.wait();
+		}
+		if (DequeueRunnableTask(consumer, node, steal, task)) {
+			ExecuteScheduledTask(task);
+
+			// Flushes the outstanding allocator's outstanding allocations
+			Allocator::ThreadFlush(allocator_flush_threshold);
+		}
+	}
+#else
+	throw NotImplementedException("DuckDB was compiled without threads! Background thread loop is not allowed.");
+#endif
+}
+
+idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
+#ifndef DUCKDB_NO_THREADS
+	TaskConsumer consumer(queues);
+	idx_t completed_tasks = 0;
+	// loop until the marker is set to false
+	while (*marker && completed_tasks < max_tasks) {
+		ScheduledTask task;
+		if (!DequeueRunnableTask(consumer, 0, true, task)) {
+			return completed_tasks;
+		}
+		completed_tasks += ExecuteScheduledTask(task);
 	}
 	return completed_tasks;
 #else
@@ -204,26 +552,15 @@ idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 
 void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 #ifndef DUCKDB_NO_THREADS
-	shared_ptr<Task> task;
+	TaskConsumer consumer(queues);
+	ScheduledTask task;
 	for (idx_t i = 0; i < max_tasks; i++) {
-		queue->semaphore.wait(TASK_TIMEOUT_USECS);
-		if (!queue->q.try_dequeue(task)) {
+		queues[0]->semaphore.wait(TASK_TIMEOUT_USECS);
+		if (!DequeueRunnableTask(consumer, 0, true, task)) {
 			return;
 		}
 		try {
-			auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
-			switch (execute_result) {
-			case TaskExecutionResult::TASK_FINISHED:
-			case TaskExecutionResult::TASK_ERROR:
-				task.reset();
-				break;
-			case TaskExecutionResult::TASK_NOT_FINISHED:
-				throw InternalException("Task should not return TASK_NOT_FINISHED in PROCESS_ALL mode");
-			case TaskExecutionResult::TASK_BLOCKED:
-				task->Deschedule();
-				task.reset();
-				break;
-			}
+			ExecuteScheduledTask(task);
 		} catch (...) {
 			return;
 		}
@@ -234,8 +571,8 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 }
 
 #ifndef DUCKDB_NO_THREADS
-static void ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker) {
-	scheduler->ExecuteForever(marker);
+static void ThreadExecuteTasks(TaskScheduler *scheduler, atomic<bool> *marker, idx_t node) {
+	scheduler->ExecuteForever(marker, node);
 }
 #endif
 
@@ -266,7 +603,9 @@ void TaskScheduler::SetAllocatorFlushTreshold(idx_t threshold) {
 void TaskScheduler::Signal(idx_t n) {
 #ifndef DUCKDB_NO_THREADS
 	typedef std::make_signed<std::size_t>::type ssize_t;
-	queue->semaphore.signal(NumericCast<ssize_t>(n));
+	for (auto &queue : queues) {
+		queue->semaphore.signal(NumericCast<ssize_t>(n));
+	}
 #endif
 }
 
@@ -276,6 +615,10 @@ void TaskScheduler::YieldThread() {
 #endif
 }
 
+void TaskScheduler::RequireRelaunch() {
+	relaunch_required = true;
+}
+
 void TaskScheduler::RelaunchThreads() {
 	lock_guard<mutex> t(thread_lock);
 	auto n = requested_thread_count.load();
@@ -286,11 +629,12 @@ void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
 #ifndef DUCKDB_NO_THREADS
 	auto &config = DBConfig::GetConfig(db);
 	auto new_thread_count = NumericCast<idx_t>(n);
-	if (threads.size() == new_thread_count) {
+	auto relaunch = relaunch_required.exchange(false);
+	if (threads.size() == new_thread_count && !relaunch) {
 		current_thread_count = NumericCast<int32_t>(threads.size() + config.options.external_threads);
 		return;
 	}
-	if (threads.size() > new_thread_count) {
+	if (threads.size() > new_thread_count || relaunch) {
 		// we are reducing the number of threads: clear all threads first
 		for (idx_t i = 0; i < threads.size(); i++) {
 			*markers[i] = false;
@@ -306,24 +650,39 @@ void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
 	}
 	if (threads.size() < new_thread_count) {
 		// we are increasing the number of threads: launch them and run tasks on them
+		auto node_count = topology->NodeCount();
+		bool pin_threads = config.options.pin_threads == ThreadPinMode::ON ||
+		                   (config.options.pin_threads == ThreadPinMode::AUTO && node_count > 1);
 		idx_t create_new_threads = new_thread_count - threads.size();
 		for (idx_t i = 0; i < create_new_threads; i++) {
+			// the threads are spread over the NUMA nodes round-robin
+			auto thread_idx = threads.size();
+			auto node = thread_idx % node_count;
 			// launch a thread and assign it a cancellation marker
 			auto marker = unique_ptr<atomic<bool>>(new atomic<bool>(true));
 			unique_ptr<thread> worker_thread;
 			try {
-				worker_thread = make_uniq<thread>(ThreadExecuteTasks, this, marker.get());
+				worker_thread = make_uniq<thread>(ThreadExecuteTasks, this, marker.get(), node);
 			} catch (std::exception &ex) {
 				// thread constructor failed - this can happen when the system has too many threads allocated
 				// in this case we cannot allocate more threads - stop launching them
 				break;
 			}
+#ifdef DUCKDB_PIN_THREADS
+			auto &cpus = topology->node_cpus[node];
+			if (pin_threads && !cpus.empty()) {
+				PinThread(*worker_thread, cpus[(thread_idx / node_count) % cpus.size()]);
+			}
+#else
+			(void)pin_threads;
+#endif
 			auto thread_wrapper = make_uniq<SchedulerThread>(std::move(worker_thread));
 
 			threads.push_back(std::move(thread_wrapper));
 			markers.push_back(std::move(marker));
 		}
 	}
+	active_node_count = MaxValue<idx_t>(MinValue<idx_t>(threads.size(), queues.size()), 1);
 	current_thread_count = NumericCast<int32_t>(threads.size() + config.options.external_threads);
 #endif
 }
@@ -530,6 +530,9 @@ BoundStatement Binder::Bind(InsertStatement &stmt) {
 	insert->AddChild(std::move(root));
 
 	BindOnConflictClause(*insert, table, stmt);
+	if (insert->action_type != OnConflictAction::UPDATE && insert->action_type != OnConflictAction::REPLACE) {
+		GetStatementProperties().only_appends = true;
+	}
 
 	if (!stmt.returning_list.empty()) {
 		insert->return_chunk = true;
@@ -0,0 +1,92 @@
+#include "duckdb/planner/filter/dynamic_filter.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
+
+namespace duckdb {
+
+void DynamicFilterData::SetFilter(unique_ptr<TableFilter> filter_p, shared_ptr<BloomFilter> bloom_filter_p,
+                                  LogicalType bloom_filter_type_p) {
+	initialized = false;
+	{
+		lock_guard<mutex> guard(lock);
+		filter = std::move(filter_p);
+	}
+	bloom_filter = std::move(bloom_filter_p);
+	bloom_filter_type = std::move(bloom_filter_type_p);
+	initialized = true;
+}
+
+void DynamicFilterData::UpdateFilter(unique_ptr<TableFilter> filter_p) {
+	shared_ptr<TableFilter> new_filter = std::move(filter_p);
+	{
+		lock_guard<mutex> guard(lock);
+		filter.swap(new_filter);
+	}
+	initialized = true;
+}
+
+void DynamicFilterData::Reset() {
+	initialized = false;
+	{
+		lock_guard<mutex> guard(lock);
+		filter.reset();
+	}
+	bloom_filter.reset();
+}
+
+shared_ptr<TableFilter> DynamicFilterData::GetFilter() const {
+	lock_guard<mutex> guard(lock);
+	return filter;
+}
+
+idx_t DynamicFilterData::FilterBloom(Vector &vector, SelectionVector &sel, idx_t count) const {
+	if (!bloom_filter || count == 0 || vector.GetType() != bloom_filter_type) {
+		return count;
+	}
+	Vector hashes(LogicalType::HASH);
+	VectorOperations::Hash(vector, hashes, sel, count);
+	return bloom_filter->Filter(hashes, sel, count);
+}
+
+DynamicFilter::DynamicFilter() : DynamicFilter(make_shared_ptr<DynamicFilterData>()) {
+}
+
+DynamicFilter::DynamicFilter(shared_ptr<DynamicFilterData> filter_data_p)
+    : TableFilter(TableFilterType::DYNAMIC_FILTER), filter_data(std::move(filter_data_p)) {
+}
+
+FilterPropagateResult DynamicFilter::CheckStatistics(BaseStatistics &stats) {
+	if (!filter_data->initialized) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	auto filter = filter_data->GetFilter();
+	if (!filter) {
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	auto result = filter->CheckStatistics(stats);
+	if (result == FilterPropagateResult::FILTER_ALWAYS_TRUE && filter_data->bloom_filter) {
+		// the Bloom filter can still filter out values within the range
+		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+	}
+	return result;
+}
+
+string DynamicFilter::ToString(const string &column_name) {
+	if (filter_data->initialized) {
+		auto filter = filter_data->GetFilter();
+		if (filter) {
+			return filter->ToString(column_name);
+		}
+	}
+	return column_name + " IN DYNAMIC_FILTER";
+}
+
+bool DynamicFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<DynamicFilter>();
+	return other.filter_data.get() == filter_data.get();
+}
+
+} // namespace duckdb
@@ -9,10 +9,85 @@ namespace duckdb {
 
 typedef duckdb_moodycamel::ConcurrentQueue<BufferEvictionNode> eviction_queue_t;
 
+//! The eviction queue of the blocks of a memory tag
 struct EvictionQueue {
+	EvictionQueue() : evict_queue_insertions(0), total_dead_nodes(0), hits(0), misses(0), second_chances(0) {
+		for (idx_t i = 0; i < EVICTION_CAUSE_COUNT; i++) {
+			evictions[i] = 0;
+		}
+	}
+
+public:
+	//! Add a node to the eviction queue. Returns true, if the queue is ready to be purged, and false otherwise.
+	bool AddToEvictionQueue(BufferEvictionNode &&node);
+	//! Tries to dequeue an element from the eviction queue, but only after acquiring the purge queue lock.
+	bool TryDequeueWithLock(BufferEvictionNode &node);
+	//! Garbage collect dead nodes in the eviction queue.
+	void Purge();
+	//! Iterate over all purgable blocks and invoke the callback. If the callback returns true
+	//! iteration continues.
+	//! - Callback signature is: bool((BufferEvictionNode &, const std::shared_ptr<BlockHandle> &)
+	//! - Callback is invoked while holding the corresponding BlockHandle mutex.
+	template <typename FN>
+	void IterateUnloadableBlocks(FN fn);
+
+	//! Increment the dead node counter in the purge queue.
+	inline void IncrementDeadNodes() {
+		total_dead_nodes++;
+	}
+	//! Decrement the dead node counter in the purge queue.
+	inline void DecrementDeadNodes() {
+		total_dead_nodes--;
+	}
+
+private:
+	//! Bulk purge dead nodes from the eviction queue. Then, enqueue those that are still alive.
+	void PurgeIteration(const idx_t purge_size);
+
+public:
+	//! The concurrent queue
 	eviction_queue_t q;
+
+	//! Statistics of the blocks in this queue
+	atomic<idx_t> hits;
+	atomic<idx_t> misses;
+	atomic<idx_t> second_chances;
+	atomic<idx_t> evictions[EVICTION_CAUSE_COUNT];
+
+private:
+	//! We trigger a purge of the eviction queue every INSERT_INTERVAL insertions
+	constexpr static idx_t INSERT_INTERVAL = 4096;
+	//! We multiply the base purge size by this value.
+	constexpr static idx_t PURGE_SIZE_MULTIPLIER = 2;
+	//! We multiply the purge size by this value to determine early-outs. This is the minimum queue size.
+	//! We never purge below this point.
+	constexpr static idx_t EARLY_OUT_MULTIPLIER = 4;
+	//! We multiply the approximate alive nodes by this value to test whether our total dead nodes
+	//! exceed their allowed ratio. Must be greater than 1.
+	constexpr static idx_t ALIVE_NODE_MULTIPLIER = 4;
+
+	//! Total number of insertions into the eviction queue. This guides the schedule for calling PurgeQueue.
+	atomic<idx_t> evict_queue_insertions;
+	//! Total dead nodes in the eviction queue. There are two scenarios in which a node dies: (1) we destroy its block
+	//! handle, or (2) we insert a newer version into the eviction queue.
+	atomic<idx_t> total_dead_nodes;
+
+	//! Locked, if a queue purge is currently active or we're trying to forcefully evict a node.
+	//! Only lets a single thread enter the purge phase.
+	mutex purge_lock;
+	//! A pre-allocated vector of eviction nodes. We reuse this to keep the allocation overhead of purges small.
+	vector<BufferEvictionNode> purge_nodes;
 };
 
+//! The order in which the eviction queues are visited when we need to free memory
+//! Persistent blocks can be dropped and read again, temporary blocks have to be written to a temporary file first,
+//! and metadata and indexes are accessed all over the place, so we evict them last
+static const MemoryTag EVICTION_ORDER[] = {
+    MemoryTag::BASE_TABLE,  MemoryTag::PARQUET_READER,  MemoryTag::CSV_READER, MemoryTag::OVERFLOW_STRINGS,
+    MemoryTag::HASH_TABLE,  MemoryTag::ORDER_BY,        MemoryTag::COLUMN_DATA, MemoryTag::IN_MEMORY_TABLE,
+    MemoryTag::ALLOCATOR,   MemoryTag::EXTENSION,       MemoryTag::METADATA,   MemoryTag::ART_INDEX};
+static_assert(sizeof(EVICTION_ORDER) / sizeof(MemoryTag) == MEMORY_TAG_COUNT, "every memory tag must be evicted");
+
 BufferEvictionNode::BufferEvictionNode(weak_ptr<BlockHandle> handle_p, idx_t eviction_seq_num)
     : handle(std::move(handle_p)), handle_sequence_number(eviction_seq_num) {
 	D_ASSERT(!handle.expired());
@@ -42,15 +117,19 @@ shared_ptr<BlockHandle> BufferEvictionNode::TryGetBlockHandle() {
 
 BufferPool::BufferPool(idx_t maximum_memory, bool track_eviction_timestamps)
     : current_memory(0), maximum_memory(maximum_memory), track_eviction_timestamps(track_eviction_timestamps),
-      queue(make_uniq<EvictionQueue>()), temporary_memory_manager(make_uniq<TemporaryMemoryManager>()),
-      evict_queue_insertions(0), total_dead_nodes(0) {
+      temporary_memory_manager(make_uniq<TemporaryMemoryManager>()) {
 	for (idx_t i = 0; i < MEMORY_TAG_COUNT; i++) {
 		memory_usage_per_tag[i] = 0;
+		queues.push_back(make_uniq<EvictionQueue>());
 	}
 }
 BufferPool::~BufferPool() {
 }
 
+EvictionQueue &BufferPool::GetEvictionQueue(MemoryTag tag) {
+	return *queues[static_cast<uint8_t>(tag)];
+}
+
 bool BufferPool::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
 
 	// The block handle is locked during this operation (Unpin),
@@ -65,18 +144,50 @@ bool BufferPool::AddToEvictionQueue(shared_ptr<BlockHandle> &handle) {
 		        .count();
 	}
 
-	BufferEvictionNode evict_node(weak_ptr<BlockHandle>(handle), ts);
-	queue->q.enqueue(evict_node);
-
+	auto &queue = GetEvictionQueue(handle->tag);
 	if (ts != 1) {
 		// we add a newer version, i.e., we kill exactly one previous version
-		IncrementDeadNodes();
+		queue.IncrementDeadNodes();
 	}
+	return queue.AddToEvictionQueue(BufferEvictionNode(weak_ptr<BlockHandle>(handle), ts));
+}
+
+bool EvictionQueue::AddToEvictionQueue(BufferEvictionNode &&node) {
+	q.enqueue(std::move(node));
+	return ++evict_queue_insertions % INSERT_INTERVAL == 0;
+}
 
-	if (++evict_queue_insertions % INSERT_INTERVAL == 0) {
-		return true;
+void BufferPool::RegisterPin(BlockHandle &handle, bool hit) {
+	auto &queue = GetEvictionQueue(handle.tag);
+	if (hit) {
+		queue.hits.fetch_add(1, std::memory_order_relaxed);
+	} else {
+		queue.misses.fetch_add(1, std::memory_order_relaxed);
 	}
-	return false;
+	// blocks that are used again while they are loaded get a second chance, blocks that are loaded once
+	// (e.g., by a large scan) are evicted first
+	handle.referenced = hit;
+}
+
+void BufferPool::IncrementDeadNodes(MemoryTag tag) {
+	GetEvictionQueue(tag).IncrementDeadNodes();
+}
+
+vector<BufferPoolStatistics> BufferPool::GetStatistics() const {
+	vector<BufferPoolStatistics> result;
+	for (idx_t i = 0; i < MEMORY_TAG_COUNT; i++) {
+		auto &queue = *queues[i];
+		BufferPoolStatistics statistics;
+		statistics.tag = MemoryTag(i);
+		statistics.hits = queue.hits.load(std::memory_order_relaxed);
+		statistics.misses = queue.misses.load(std::memory_order_relaxed);
+		statistics.second_chances = queue.second_chances.load(std::memory_order_relaxed);
+		for (idx_t cause_idx = 0; cause_idx < EVICTION_CAUSE_COUNT; cause_idx++) {
+			statistics.evictions[cause_idx] = queue.evictions[cause_idx].load(std::memory_order_relaxed);
+		}
+		result.push_back(statistics);
+	}
+	return result;
 }
 
 void BufferPool::UpdateUsedMemory(MemoryTag tag, int64_t size) {
@@ -107,6 +218,11 @@ TemporaryMemoryManager &BufferPool::GetTemporaryMemoryManager() {
 
 BufferPool::EvictionResult BufferPool::EvictBlocks(MemoryTag tag, idx_t extra_memory, idx_t memory_limit,
                                                    unique_ptr<FileBuffer> *buffer) {
+	return EvictBlocksInternal(EvictionCause::ALLOCATION, tag, extra_memory, memory_limit, buffer);
+}
+
+BufferPool::EvictionResult BufferPool::EvictBlocksInternal(EvictionCause cause, MemoryTag tag, idx_t extra_memory,
+                                                           idx_t memory_limit, unique_ptr<FileBuffer> *buffer) {
 	TempBufferPoolReservation r(tag, *this, extra_memory);
 	bool found = false;
 
@@ -114,26 +230,45 @@ BufferPool::EvictionResult BufferPool::EvictBlocks(MemoryTag tag, idx_t extra_me
 		return {true, std::move(r)};
 	}
 
-	IterateUnloadableBlocks([&](BufferEvictionNode &, const shared_ptr<BlockHandle> &handle) {
-		// hooray, we can unload the block
-		if (buffer && handle->buffer->AllocSize() == extra_memory) {
-			// we can re-use the memory directly
-			*buffer = handle->UnloadAndTakeBlock();
-			found = true;
-			return false;
-		}
+	for (auto &queue_tag : EVICTION_ORDER) {
+		auto &queue = GetEvictionQueue(queue_tag);
+		auto &evictions = queue.evictions[static_cast<uint8_t>(cause)];
+		// every block in the queue gets at most one second chance during this iteration
+		auto max_second_chances = queue.q.size_approx();
+		queue.IterateUnloadableBlocks([&](BufferEvictionNode &, const shared_ptr<BlockHandle> &handle) {
+			if (handle->referenced && max_second_chances > 0) {
+				// the block was used again since it was loaded: move it to the back of the queue
+				handle->referenced = false;
+				max_second_chances--;
+				queue.second_chances.fetch_add(1, std::memory_order_relaxed);
+				queue.AddToEvictionQueue(BufferEvictionNode(weak_ptr<BlockHandle>(handle), ++handle->eviction_seq_num));
+				return true;
+			}
+
+			// hooray, we can unload the block
+			evictions.fetch_add(1, std::memory_order_relaxed);
+			if (buffer && handle->buffer->AllocSize() == extra_memory) {
+				// we can re-use the memory directly
+				*buffer = handle->UnloadAndTakeBlock();
+				found = true;
+				return false;
+			}
 
-		// release the memory and mark the block as unloaded
-		handle->Unload();
+			// release the memory and mark the block as unloaded
+			handle->Unload();
 
-		if (current_memory <= memory_limit) {
-			found = true;
-			return false;
-		}
+			if (current_memory <= memory_limit) {
+				found = true;
+				return false;
+			}
 
-		// Continue iteration
-		return true;
-	});
+			// Continue iteration
+			return true;
+		});
+		if (found) {
+			break;
+		}
+	}
 
 	if (!found) {
 		r.Resize(0);
@@ -148,23 +283,27 @@ idx_t BufferPool::PurgeAgedBlocks(uint32_t max_age_sec) {
 	                  .count();
 	int64_t limit = now - (static_cast<int64_t>(max_age_sec) * 1000);
 	idx_t purged_bytes = 0;
-	IterateUnloadableBlocks([&](BufferEvictionNode &node, const shared_ptr<BlockHandle> &handle) {
-		// We will unload this block regardless. But stop the iteration immediately afterward if this
-		// block is younger than the age threshold.
-		bool is_fresh = handle->lru_timestamp_msec >= limit && handle->lru_timestamp_msec <= now;
-		purged_bytes += handle->GetMemoryUsage();
-		handle->Unload();
-		return is_fresh;
-	});
+	for (auto &queue : queues) {
+		auto &evictions = queue->evictions[static_cast<uint8_t>(EvictionCause::AGE)];
+		queue->IterateUnloadableBlocks([&](BufferEvictionNode &node, const shared_ptr<BlockHandle> &handle) {
+			// We will unload this block regardless. But stop the iteration immediately afterward if this
+			// block is younger than the age threshold.
+			bool is_fresh = handle->lru_timestamp_msec >= limit && handle->lru_timestamp_msec <= now;
+			purged_bytes += handle->GetMemoryUsage();
+			evictions.fetch_add(1, std::memory_order_relaxed);
+			handle->Unload();
+			return is_fresh;
+		});
+	}
 	return purged_bytes;
 }
 
 template <typename FN>
-void BufferPool::IterateUnloadableBlocks(FN fn) {
+void EvictionQueue::IterateUnloadableBlocks(FN fn) {
 	for (;;) {
 		// get a block to unpin from the queue
 		BufferEvictionNode node;
-		if (!queue->q.try_dequeue(node)) {
+		if (!q.try_dequeue(node)) {
 			// we could not dequeue any eviction node, so we try one more time,
 			// but more aggressively
 			if (!TryDequeueWithLock(node)) {
@@ -193,12 +332,12 @@ void BufferPool::IterateUnloadableBlocks(FN fn) {
 	}
 }
 
-bool BufferPool::TryDequeueWithLock(BufferEvictionNode &node) {
+bool EvictionQueue::TryDequeueWithLock(BufferEvictionNode &node) {
 	lock_guard<mutex> lock(purge_lock);
-	return queue->q.try_dequeue(node);
+	return q.try_dequeue(node);
 }
 
-void BufferPool::PurgeIteration(const idx_t purge_size) {
+void EvictionQueue::PurgeIteration(const idx_t purge_size) {
 	// if this purge is significantly smaller or bigger than the previous purge, then
 	// we need to resize the purge_nodes vector. Note that this barely happens, as we
 	// purge queue_insertions * PURGE_SIZE_MULTIPLIER nodes
@@ -208,7 +347,7 @@ void BufferPool::PurgeIteration(const idx_t purge_size) {
 	}
 
 	// bulk purge
-	idx_t actually_dequeued = queue->q.try_dequeue_bulk(purge_nodes.begin(), purge_size);
+	idx_t actually_dequeued = q.try_dequeue_bulk(purge_nodes.begin(), purge_size);
 
 	// retrieve all alive nodes that have been wrongly dequeued
 	idx_t alive_nodes = 0;
@@ -216,7 +355,7 @@ void BufferPool::PurgeIteration(const idx_t purge_size) {
 		auto &node = purge_nodes[i];
 		auto handle = node.TryGetBlockHandle();
 		if (handle) {
-			queue->q.enqueue(std::move(node));
+			q.enqueue(std::move(node));
 			alive_nodes++;
 		}
 	}
@@ -225,7 +364,12 @@ void BufferPool::PurgeIteration(const idx_t purge_size) {
 }
 
 void BufferPool::PurgeQueue() {
+	for (auto &queue : queues) {
+		queue->Purge();
+	}
+}
 
+void EvictionQueue::Purge() {
 	// only one thread purges the queue, all other threads early-out
 	if (!purge_lock.try_lock()) {
 		return;
@@ -236,7 +380,7 @@ void BufferPool::PurgeQueue() {
 	idx_t purge_size = INSERT_INTERVAL * PURGE_SIZE_MULTIPLIER;
 
 	// get an estimate of the queue size as-of now
-	idx_t approx_q_size = queue->q.size_approx();
+	idx_t approx_q_size = q.size_approx();
 
 	// early-out, if the queue is not big enough to justify purging
 	// - we want to keep the LRU characteristic alive
@@ -266,7 +410,7 @@ void BufferPool::PurgeQueue() {
 		PurgeIteration(purge_size);
 
 		// update relevant sizes and potentially early-out
-		approx_q_size = queue->q.size_approx();
+		approx_q_size = q.size_approx();
 
 		// early-out according to (2.1)
 		if (approx_q_size < purge_size * EARLY_OUT_MULTIPLIER) {
@@ -289,7 +433,7 @@ void BufferPool::PurgeQueue() {
 void BufferPool::SetLimit(idx_t limit, const char *exception_postscript) {
 	lock_guard<mutex> l_lock(limit_lock);
 	// try to evict until the limit is reached
-	if (!EvictBlocks(MemoryTag::EXTENSION, 0, limit).success) {
+	if (!EvictBlocksInternal(EvictionCause::MEMORY_LIMIT, MemoryTag::EXTENSION, 0, limit, nullptr).success) {
 		throw OutOfMemoryException(
 		    "Failed to change memory limit to %lld: could not free up enough memory for the new limit%s", limit,
 		    exception_postscript);
@@ -298,7 +442,7 @@ void BufferPool::SetLimit(idx_t limit, const char *exception_postscript) {
 	// set the global maximum memory to the new limit if successful
 	maximum_memory = limit;
 	// evict again
-	if (!EvictBlocks(MemoryTag::EXTENSION, 0, limit).success) {
+	if (!EvictBlocksInternal(EvictionCause::MEMORY_LIMIT, MemoryTag::EXTENSION, 0, limit, nullptr).success) {
 		// failed: go back to old limit
 		maximum_memory = old_limit;
 		throw OutOfMemoryException(
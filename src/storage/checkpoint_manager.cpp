@@ -190,9 +190,11 @@ void SingleFileCheckpointWriter::CreateCheckpoint() {
 	// WAL we write an entry CHECKPOINT "meta_block_id" into the WAL upon loading, if we see there is an entry
 	// CHECKPOINT "meta_block_id", and the id MATCHES the head idin the file we know that the database was successfully
 	// checkpointed, so we know that we should avoid replaying the WAL to avoid duplicating data
-	bool wal_is_empty = storage_manager.GetWALSize() == 0;
+	// in a background checkpoint, commits are written to a separate WAL while the checkpoint runs: the flag goes into
+	// the WAL that contains the checkpointed changes
+	auto wal = storage_manager.GetCheckpointWAL();
+	bool wal_is_empty = !wal || !wal->Initialized() || wal->GetWriter().GetFileSize() == 0;
 	if (!wal_is_empty) {
-		auto wal = storage_manager.GetWAL();
 		wal->WriteCheckpoint(meta_block);
 		wal->Flush();
 	}
@@ -216,7 +218,8 @@ void SingleFileCheckpointWriter::CreateCheckpoint() {
 	block_manager.Truncate();
 
 	// truncate the WAL
-	if (!wal_is_empty) {
+	// a background checkpoint replaces the WAL when it is finished, see StorageManager::FinishBackgroundCheckpoint
+	if (!wal_is_empty && !storage_manager.InBackgroundCheckpoint()) {
 		storage_manager.ResetWAL();
 	}
 }
@@ -32,7 +32,8 @@ namespace duckdb {
 
 DataTableInfo::DataTableInfo(AttachedDatabase &db, shared_ptr<TableIOManager> table_io_manager_p, string schema,
                              string table)
-    : db(db), table_io_manager(std::move(table_io_manager_p)), schema(std::move(schema)), table(std::move(table)) {
+    : db(db), table_io_manager(std::move(table_io_manager_p)), schema(std::move(schema)), table(std::move(table)),
+      index_cleanup_commit_id(0) {
 }
 
 void DataTableInfo::InitializeIndexes(ClientContext &context, const char *index_type) {
@@ -43,6 +44,16 @@ bool DataTableInfo::IsTemporary() const {
 	return db.IsTemporary();
 }
 
+void DataTableInfo::SetIndexCleanupCommit(transaction_t commit_id) {
+	auto current = index_cleanup_commit_id.load();
+	while (current < commit_id && !index_cleanup_commit_id.compare_exchange_weak(current, commit_id)) {
+	}
+}
+
+bool DataTableInfo::IndexesContainVisibleRows(transaction_t start_time) const {
+	return start_time >= index_cleanup_commit_id.load();
+}
+
 DataTable::DataTable(AttachedDatabase &db, shared_ptr<TableIOManager> table_io_manager_p, const string &schema,
                      const string &table, vector<ColumnDefinition> column_definitions_p,
                      unique_ptr<PersistentTableData> data)
@@ -953,6 +964,10 @@ void DataTable::CommitAppend(transaction_t commit_id, idx_t row_start, idx_t cou
 	row_groups->CommitAppend(commit_id, row_start, count);
 }
 
+void DataTable::CleanupVersions(transaction_t lowest_active_start, idx_t row_start, idx_t count) {
+	row_groups->CleanupVersions(lowest_active_start, row_start, count);
+}
+
 void DataTable::RevertAppendInternal(idx_t start_row) {
 	D_ASSERT(is_root);
 	// revert appends made to row_groups
@@ -1405,6 +1420,10 @@ void DataTable::Checkpoint(TableDataWriter &writer, Serializer &serializer) {
 	writer.FinalizeTable(global_stats, info.get(), serializer);
 }
 
+void DataTable::SealRowGroups() {
+	row_groups->SealRowGroups();
+}
+
 void DataTable::CommitDropColumn(idx_t index) {
 	row_groups->CommitDropColumn(index);
 }
@@ -258,6 +258,16 @@ bool LocalTableManager::IsEmpty() {
 	return table_storage.empty();
 }
 
+bool LocalTableManager::AppendsToIndexedTables() {
+	lock_guard<mutex> l(table_storage_lock);
+	for (auto &storage : table_storage) {
+		if (storage.first.get().HasIndexes()) {
+			return true;
+		}
+	}
+	return false;
+}
+
 shared_ptr<LocalTableStorage> LocalTableManager::MoveEntry(DataTable &table) {
 	lock_guard<mutex> l(table_storage_lock);
 	auto entry = table_storage.find(table);
@@ -411,6 +421,10 @@ idx_t LocalStorage::EstimatedSize() {
 	return table_manager.EstimatedSize();
 }
 
+bool LocalStorage::AppendsToIndexedTables() {
+	return table_manager.AppendsToIndexedTables();
+}
+
 idx_t LocalStorage::Delete(DataTable &table, Vector &row_ids, idx_t count) {
 	auto storage = table_manager.GetStorage(table);
 	D_ASSERT(storage);
@@ -198,6 +198,7 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 		if (handle->state == BlockState::BLOCK_LOADED) {
 			// the block is loaded, increment the reader count and set the BufferHandle
 			handle->readers++;
+			buffer_pool.RegisterPin(*handle, true);
 			buf = handle->Load(handle);
 		}
 		required_memory = handle->memory_usage;
@@ -219,11 +220,13 @@ BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
 			// the block is loaded, increment the reader count and return a pointer to the handle
 			handle->readers++;
 			reservation.Resize(0);
+			buffer_pool.RegisterPin(*handle, true);
 			buf = handle->Load(handle);
 		} else {
 			// now we can actually load the current block
 			D_ASSERT(handle->readers == 0);
 			handle->readers = 1;
+			buffer_pool.RegisterPin(*handle, false);
 			buf = handle->Load(handle, std::move(reusable_buffer));
 			handle->memory_charge = std::move(reservation);
 			// in the case of a variable sized block, the buffer may be smaller than a full block.
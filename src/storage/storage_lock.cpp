@@ -2,68 +2,81 @@
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/assert.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 
 struct StorageLockInternals : enable_shared_from_this<StorageLockInternals> {
 public:
-	StorageLockInternals() : read_count(0) {
+	StorageLockInternals() : exclusive(false), read_count(0) {
 	}
 
-	mutex exclusive_lock;
-	atomic<idx_t> read_count;
+	//! The exclusive lock is a flag rather than a mutex, so it can be released by a different thread than the one
+	//! that obtained it (e.g. by a checkpoint that runs in the background)
+	mutex lock;
+	std::condition_variable cv;
+	bool exclusive;
+	idx_t read_count;
 
 public:
 	unique_ptr<StorageLockKey> GetExclusiveLock() {
-		exclusive_lock.lock();
-		while (read_count != 0) {
-		}
+		unique_lock<mutex> guard(lock);
+		cv.wait(guard, [&]() { return !exclusive; });
+		// block new shared locks while we wait for the active ones to be released
+		exclusive = true;
+		cv.wait(guard, [&]() { return read_count == 0; });
 		return make_uniq<StorageLockKey>(shared_from_this(), StorageLockType::EXCLUSIVE);
 	}
 
 	unique_ptr<StorageLockKey> GetSharedLock() {
-		exclusive_lock.lock();
+		unique_lock<mutex> guard(lock);
+		cv.wait(guard, [&]() { return !exclusive; });
 		read_count++;
-		exclusive_lock.unlock();
 		return make_uniq<StorageLockKey>(shared_from_this(), StorageLockType::SHARED);
 	}
 
 	unique_ptr<StorageLockKey> TryGetExclusiveLock() {
-		if (!exclusive_lock.try_lock()) {
-			// could not lock mutex
-			return nullptr;
-		}
-		if (read_count != 0) {
-			// there are active readers - cannot get exclusive lock
-			exclusive_lock.unlock();
+		lock_guard<mutex> guard(lock);
+		if (exclusive || read_count != 0) {
+			// the lock is held, or there are active readers - cannot get exclusive lock
 			return nullptr;
 		}
 		// success!
+		exclusive = true;
 		return make_uniq<StorageLockKey>(shared_from_this(), StorageLockType::EXCLUSIVE);
 	}
 
-	unique_ptr<StorageLockKey> TryUpgradeCheckpointLock(StorageLockKey &lock) {
-		if (lock.GetType() != StorageLockType::SHARED) {
+	unique_ptr<StorageLockKey> TryUpgradeCheckpointLock(StorageLockKey &key) {
+		if (key.GetType() != StorageLockType::SHARED) {
 			throw InternalException("StorageLock::TryUpgradeLock called on an exclusive lock");
 		}
-		if (!exclusive_lock.try_lock()) {
-			// could not lock mutex
+		lock_guard<mutex> guard(lock);
+		if (exclusive) {
 			return nullptr;
 		}
 		if (read_count != 1) {
 			// other shared locks are active: failed to upgrade
 			D_ASSERT(read_count != 0);
-			exclusive_lock.unlock();
 			return nullptr;
 		}
 		// no other shared locks active: success!
+		exclusive = true;
 		return make_uniq<StorageLockKey>(shared_from_this(), StorageLockType::EXCLUSIVE);
 	}
 
 	void ReleaseExclusiveLock() {
-		exclusive_lock.unlock();
+		{
+			lock_guard<mutex> guard(lock);
+			exclusive = false;
+		}
+		cv.notify_all();
 	}
 	void ReleaseSharedLock() {
-		read_count--;
+		{
+			lock_guard<mutex> guard(lock);
+			read_count--;
+		}
+		cv.notify_all();
 	}
 };
 
@@ -1,6 +1,8 @@
 #include "duckdb/storage/storage_manager.hpp"
 
 #include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
+#include "duckdb/catalog/duck_catalog.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/serializer/buffered_file_reader.hpp"
 #include "duckdb/function/function.hpp"
@@ -63,7 +65,7 @@ int64_t StorageManager::GetWALSize() {
 		return 0;
 	}
 	if (!wal->Initialized()) {
-		D_ASSERT(!FileSystem::Get(db).FileExists(GetWALPath()));
+		D_ASSERT(InBackgroundCheckpoint() || !FileSystem::Get(db).FileExists(GetWALPath()));
 		return 0;
 	}
 	return wal->GetWriter().GetFileSize();
@@ -94,18 +96,78 @@ void StorageManager::ResetWAL() {
 	wal.reset();
 }
 
-string StorageManager::GetWALPath() {
+optional_ptr<WriteAheadLog> StorageManager::GetCheckpointWAL() {
+	if (checkpoint_wal) {
+		return checkpoint_wal.get();
+	}
+	return GetWAL();
+}
+
+void StorageManager::SealTables() {
+	auto &catalog = Catalog::GetCatalog(db).Cast<DuckCatalog>();
+	catalog.ScanSchemas([&](SchemaCatalogEntry &schema) {
+		schema.Scan(CatalogType::TABLE_ENTRY, [&](CatalogEntry &entry) {
+			if (entry.type == CatalogType::TABLE_ENTRY && !entry.internal) {
+				entry.Cast<DuckTableEntry>().GetStorage().SealRowGroups();
+			}
+		});
+	});
+}
+
+void StorageManager::BeginBackgroundCheckpoint() {
+	D_ASSERT(!checkpoint_wal);
+	// rows that are appended from now on are not part of the checkpoint
+	SealTables();
+
+	// the current WAL contains exactly the changes that are checkpointed
+	// commits are written to a separate WAL from now on, which replaces it when the checkpoint is finished
+	if (!GetWAL()) {
+		throw InternalException("StorageManager::BeginBackgroundCheckpoint called without a WAL");
+	}
+	checkpoint_wal = std::move(wal);
+	auto background_wal_path = GetBackgroundWALPath();
+	auto &fs = FileSystem::Get(db);
+	if (fs.FileExists(background_wal_path)) {
+		fs.RemoveFile(background_wal_path);
+	}
+	wal = make_uniq<WriteAheadLog>(db, background_wal_path);
+}
+
+void StorageManager::FinishBackgroundCheckpoint() {
+	D_ASSERT(checkpoint_wal);
+	// the checkpointed changes are in the database file now
+	checkpoint_wal->Delete();
+	checkpoint_wal.reset();
+
+	// the commits that were made during the checkpoint become the contents of the WAL
+	// the WAL is reopened (lazily) at its regular path
+	wal.reset();
+	auto &fs = FileSystem::Get(db);
+	auto background_wal_path = GetBackgroundWALPath();
+	if (fs.FileExists(background_wal_path)) {
+		fs.MoveFile(background_wal_path, GetWALPath());
+	}
+}
 
+static string GetWALPathWithExtension(const string &path, const string &extension) {
 	std::size_t question_mark_pos = path.find('?');
 	auto wal_path = path;
 	if (question_mark_pos != std::string::npos) {
-		wal_path.insert(question_mark_pos, ".wal");
+		wal_path.insert(question_mark_pos, extension);
 	} else {
-		wal_path += ".wal";
+		wal_path += extension;
 	}
 	return wal_path;
 }
 
+string StorageManager::GetWALPath() {
+	return GetWALPathWithExtension(path, ".wal");
+}
+
+string StorageManager::GetBackgroundWALPath() {
+	return GetWALPathWithExtension(path, ".wal.background");
+}
+
 bool StorageManager::InMemory() {
 	D_ASSERT(!path.empty());
 	return path == IN_MEMORY_PATH;
@@ -162,6 +224,7 @@ void SingleFileStorageManager::LoadDatabase() {
 
 	StorageManagerOptions options;
 	options.read_only = read_only;
+	bool complete_background_checkpoint = false;
 	options.use_direct_io = config.options.use_direct_io;
 	options.debug_initialize = config.options.debug_initialize;
 
@@ -171,11 +234,12 @@ void SingleFileStorageManager::LoadDatabase() {
 		// create a new file
 
 		// check if a WAL file already exists
-		auto wal_path = GetWALPath();
-		if (fs.FileExists(wal_path)) {
-			// WAL file exists but database file does not
-			// remove the WAL
-			fs.RemoveFile(wal_path);
+		for (auto &wal_path : {GetWALPath(), GetBackgroundWALPath()}) {
+			if (fs.FileExists(wal_path)) {
+				// WAL file exists but database file does not
+				// remove the WAL
+				fs.RemoveFile(wal_path);
+			}
 		}
 
 		// initialize the block manager while creating a new db file
@@ -206,9 +270,39 @@ void SingleFileStorageManager::LoadDatabase() {
 				fs.RemoveFile(wal_path);
 			}
 		}
+
+		// if a background checkpoint was interrupted, the appends that were committed while it ran are in a separate
+		// WAL that follows the regular one
+		auto background_wal_path = GetBackgroundWALPath();
+		handle =
+		    fs.OpenFile(background_wal_path, FileFlags::FILE_FLAGS_READ | FileFlags::FILE_FLAGS_NULL_IF_NOT_EXISTS);
+		if (handle) {
+			if (!read_only) {
+				// these appends are placed in new row groups, so that the checkpoint can be completed without them
+				SealTables();
+				complete_background_checkpoint = true;
+			}
+			WriteAheadLog::Replay(db, std::move(handle));
+		}
 	}
 
 	load_complete = true;
+
+	if (complete_background_checkpoint) {
+		// complete the interrupted checkpoint: this leaves the appends of the separate WAL in the regular WAL
+		checkpoint_wal = make_uniq<WriteAheadLog>(db, GetWALPath());
+		if (fs.FileExists(GetWALPath())) {
+			checkpoint_wal->Initialize();
+		}
+		wal = make_uniq<WriteAheadLog>(db, GetBackgroundWALPath());
+		wal->Initialize();
+
+		CheckpointOptions checkpoint_options;
+		checkpoint_options.action = CheckpointAction::FORCE_CHECKPOINT;
+		checkpoint_options.type = CheckpointType::CONCURRENT_CHECKPOINT;
+		CreateCheckpoint(checkpoint_options);
+		FinishBackgroundCheckpoint();
+	}
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -218,6 +312,9 @@ class SingleFileStorageCommitState : public StorageCommitState {
 	idx_t initial_written = 0;
 	optional_ptr<WriteAheadLog> log;
 	bool checkpoint;
+	//! The WAL that has to be synced by SyncCommit (if any), and the position up to which it has to be synced
+	optional_ptr<WriteAheadLog> sync_log;
+	idx_t sync_position = 0;
 
 public:
 	SingleFileStorageCommitState(StorageManager &storage_manager, bool checkpoint);
@@ -235,6 +332,7 @@ public:
 
 	// Make the commit persistent
 	void FlushCommit() override;
+	void SyncCommit() override;
 };
 
 SingleFileStorageCommitState::SingleFileStorageCommitState(StorageManager &storage_manager, bool checkpoint)
@@ -264,7 +362,8 @@ void SingleFileStorageCommitState::FlushCommit() {
 			(void)checkpoint;
 			D_ASSERT(!checkpoint);
 			D_ASSERT(!log->skip_writing);
-			log->Flush();
+			sync_position = log->FlushCommit();
+			sync_log = log;
 		}
 		log->skip_writing = false;
 	}
@@ -272,6 +371,13 @@ void SingleFileStorageCommitState::FlushCommit() {
 	log = nullptr;
 }
 
+void SingleFileStorageCommitState::SyncCommit() {
+	if (sync_log) {
+		sync_log->SyncCommit(sync_position);
+		sync_log = nullptr;
+	}
+}
+
 unique_ptr<StorageCommitState> SingleFileStorageManager::GenStorageCommitState(Transaction &transaction,
                                                                                bool checkpoint) {
 	return make_uniq<SingleFileStorageCommitState>(*this, checkpoint);
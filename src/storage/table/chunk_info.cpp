@@ -95,6 +95,10 @@ idx_t ChunkConstantInfo::GetCommittedDeletedCount(idx_t max_count) {
 	return delete_id < TRANSACTION_ID_START ? max_count : 0;
 }
 
+bool ChunkConstantInfo::Cleanup(transaction_t lowest_active_start) {
+	return insert_id < lowest_active_start && delete_id == NOT_DELETED_ID;
+}
+
 void ChunkConstantInfo::Write(WriteStream &writer) const {
 	D_ASSERT(HasDeletes());
 	ChunkInfo::Write(writer);
@@ -114,12 +118,39 @@ unique_ptr<ChunkInfo> ChunkConstantInfo::Read(ReadStream &reader) {
 //===--------------------------------------------------------------------===//
 ChunkVectorInfo::ChunkVectorInfo(idx_t start)
     : ChunkInfo(start, ChunkInfoType::VECTOR_INFO), insert_id(0), same_inserted_id(true), any_deleted(false) {
+	memset(deleted_mask, 0, sizeof(deleted_mask));
+}
+
+transaction_t ChunkVectorInfo::GetDeleteId(idx_t row) const {
+	if (deleted) {
+		return deleted[row];
+	}
+	// deletes in the mask were committed before any running transaction started
+	return any_deleted && IsDeletedInMask(row) ? 0 : NOT_DELETED_ID;
+}
+
+void ChunkVectorInfo::InitializeInserted() {
+	if (inserted) {
+		return;
+	}
+	inserted = make_unsafe_uniq_array<transaction_t>(STANDARD_VECTOR_SIZE);
 	for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; i++) {
-		inserted[i] = 0;
-		deleted[i] = NOT_DELETED_ID;
+		inserted[i] = insert_id;
 	}
 }
 
+void ChunkVectorInfo::InitializeDeleted() {
+	if (deleted) {
+		return;
+	}
+	auto new_deleted = make_unsafe_uniq_array<transaction_t>(STANDARD_VECTOR_SIZE);
+	for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; i++) {
+		new_deleted[i] = GetDeleteId(i);
+	}
+	deleted = std::move(new_deleted);
+	memset(deleted_mask, 0, sizeof(deleted_mask));
+}
+
 template <class OP>
 idx_t ChunkVectorInfo::TemplatedGetSelVector(transaction_t start_time, transaction_t transaction_id,
                                              SelectionVector &sel_vector, idx_t max_count) const {
@@ -135,6 +166,25 @@ idx_t ChunkVectorInfo::TemplatedGetSelVector(transaction_t start_time, transacti
 		if (!OP::UseInsertedVersion(start_time, transaction_id, insert_id)) {
 			return 0;
 		}
+		if (HasCompactDeletes()) {
+			// all deletes are visible to every transaction: only the deleted tuples in the mask are skipped
+			for (idx_t entry_idx = 0, base_idx = 0; base_idx < max_count; entry_idx++, base_idx += 64) {
+				auto entry = deleted_mask[entry_idx];
+				idx_t next = MinValue<idx_t>(base_idx + 64, max_count);
+				if (entry == 0) {
+					for (idx_t i = base_idx; i < next; i++) {
+						sel_vector.set_index(count++, i);
+					}
+					continue;
+				}
+				for (idx_t i = base_idx; i < next; i++) {
+					if (!(entry & (uint64_t(1) << (i - base_idx)))) {
+						sel_vector.set_index(count++, i);
+					}
+				}
+			}
+			return count;
+		}
 		// have to check deleted flag
 		for (idx_t i = 0; i < max_count; i++) {
 			if (OP::UseDeletedVersion(start_time, transaction_id, deleted[i])) {
@@ -175,10 +225,12 @@ idx_t ChunkVectorInfo::GetSelVector(TransactionData transaction, SelectionVector
 }
 
 bool ChunkVectorInfo::Fetch(TransactionData transaction, row_t row) {
-	return UseVersion(transaction, inserted[row]) && !UseVersion(transaction, deleted[row]);
+	return UseVersion(transaction, GetInsertId(UnsafeNumericCast<idx_t>(row))) &&
+	       !UseVersion(transaction, GetDeleteId(UnsafeNumericCast<idx_t>(row)));
 }
 
 idx_t ChunkVectorInfo::Delete(transaction_t transaction_id, row_t rows[], idx_t count) {
+	InitializeDeleted();
 	any_deleted = true;
 
 	idx_t deleted_tuples = 0;
@@ -200,6 +252,7 @@ idx_t ChunkVectorInfo::Delete(transaction_t transaction_id, row_t rows[], idx_t
 }
 
 void ChunkVectorInfo::CommitDelete(transaction_t commit_id, const DeleteInfo &info) {
+	InitializeDeleted();
 	if (info.is_consecutive) {
 		for (idx_t i = 0; i < info.count; i++) {
 			deleted[i] = commit_id;
@@ -216,9 +269,18 @@ void ChunkVectorInfo::Append(idx_t start, idx_t end, transaction_t commit_id) {
 	if (start == 0) {
 		insert_id = commit_id;
 	} else if (insert_id != commit_id) {
+		// the tuples now have different insert ids: materialize them
+		// the mask of deleted tuples is only used if all tuples have the same insert id
+		InitializeInserted();
+		if (any_deleted) {
+			InitializeDeleted();
+		}
 		same_inserted_id = false;
 		insert_id = NOT_DELETED_ID;
 	}
+	if (!inserted) {
+		return;
+	}
 	for (idx_t i = start; i < end; i++) {
 		inserted[i] = commit_id;
 	}
@@ -228,6 +290,9 @@ void ChunkVectorInfo::CommitAppend(transaction_t commit_id, idx_t start, idx_t e
 	if (same_inserted_id) {
 		insert_id = commit_id;
 	}
+	if (!inserted) {
+		return;
+	}
 	for (idx_t i = start; i < end; i++) {
 		inserted[i] = commit_id;
 	}
@@ -237,11 +302,63 @@ bool ChunkVectorInfo::HasDeletes() const {
 	return any_deleted;
 }
 
+bool ChunkVectorInfo::Cleanup(transaction_t lowest_active_start) {
+	// every insert and delete must be committed before the oldest running transaction started
+	if (inserted) {
+		for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; i++) {
+			if (inserted[i] >= lowest_active_start) {
+				return false;
+			}
+		}
+	} else if (insert_id >= lowest_active_start) {
+		return false;
+	}
+	if (deleted) {
+		for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; i++) {
+			if (deleted[i] >= lowest_active_start && deleted[i] != NOT_DELETED_ID) {
+				return false;
+			}
+		}
+	}
+	if (!any_deleted) {
+		// all tuples are visible to every transaction
+		return true;
+	}
+	// the exact transaction ids are no longer needed: all tuples are inserted at 0 and deleted at 0 (if deleted)
+	inserted.reset();
+	insert_id = 0;
+	same_inserted_id = true;
+	if (deleted) {
+		bool has_deleted_rows = false;
+		for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; i++) {
+			if (deleted[i] != NOT_DELETED_ID) {
+				deleted_mask[i / 64] |= uint64_t(1) << (i % 64);
+				has_deleted_rows = true;
+			}
+		}
+		deleted.reset();
+		if (!has_deleted_rows) {
+			// all deletes were rolled back
+			any_deleted = false;
+			return true;
+		}
+	}
+	return false;
+}
+
 idx_t ChunkVectorInfo::GetCommittedDeletedCount(idx_t max_count) {
 	if (!any_deleted) {
 		return 0;
 	}
 	idx_t delete_count = 0;
+	if (HasCompactDeletes()) {
+		for (idx_t i = 0; i < max_count; i++) {
+			if (IsDeletedInMask(i)) {
+				delete_count++;
+			}
+		}
+		return delete_count;
+	}
 	for (idx_t i = 0; i < max_count; i++) {
 		if (deleted[i] < TRANSACTION_ID_START) {
 			delete_count++;
@@ -283,9 +400,10 @@ unique_ptr<ChunkInfo> ChunkVectorInfo::Read(ReadStream &reader) {
 	result->any_deleted = true;
 	ValidityMask mask;
 	mask.Read(reader, STANDARD_VECTOR_SIZE);
+	// deletes that are read from disk are visible to every transaction: store them in the mask
 	for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; i++) {
 		if (mask.RowIsValid(i)) {
-			result->deleted[i] = 0;
+			result->deleted_mask[i / 64] |= uint64_t(1) << (i % 64);
 		}
 	}
 	return std::move(result);
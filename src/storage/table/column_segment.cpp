@@ -7,6 +7,7 @@
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
+#include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/storage/table/scan_state.hpp"
@@ -501,6 +502,19 @@ idx_t ColumnSegment::FilterSelection(SelectionVector &sel, Vector &vector, Unifi
 		return FilterSelection(sel, *child_vec, child_data, *struct_filter.child_filter, scan_count,
 		                       approved_tuple_count);
 	}
+	case TableFilterType::DYNAMIC_FILTER: {
+		auto &filter_data = *filter.Cast<DynamicFilter>().filter_data;
+		if (!filter_data.initialized) {
+			// the filter has not been set (yet)
+			return approved_tuple_count;
+		}
+		auto range_filter = filter_data.GetFilter();
+		if (range_filter) {
+			FilterSelection(sel, vector, vdata, *range_filter, scan_count, approved_tuple_count);
+		}
+		approved_tuple_count = filter_data.FilterBloom(vector, sel, approved_tuple_count);
+		return approved_tuple_count;
+	}
 	default:
 		throw InternalException("FIXME: unsupported type for filter selection");
 	}
@@ -55,7 +55,7 @@ unique_ptr<RowGroup> RowGroupSegmentTree::LoadSegment() {
 RowGroupCollection::RowGroupCollection(shared_ptr<DataTableInfo> info_p, BlockManager &block_manager,
                                        vector<LogicalType> types_p, idx_t row_start_p, idx_t total_rows_p)
     : block_manager(block_manager), total_rows(total_rows_p), info(std::move(info_p)), types(std::move(types_p)),
-      row_start(row_start_p), allocation_size(0) {
+      row_start(row_start_p), allocation_size(0), sealed_row_groups(DConstants::INVALID_INDEX) {
 	row_groups = make_shared_ptr<RowGroupSegmentTree>(*this);
 }
 
@@ -316,6 +316,9 @@ void RowGroupCollection::InitializeAppend(TransactionData transaction, TableAppe
 	if (IsEmpty(l)) {
 		// empty row group collection: empty first row group
 		AppendRowGroup(l, row_start);
+	} else if (row_groups->GetSegmentCount(l) == sealed_row_groups) {
+		// the last row group is being written by a background checkpoint: start a new row group
+		AppendRowGroup(l, row_start + total_rows);
 	}
 	state.start_row_group = row_groups->GetLastSegment(l);
 	D_ASSERT(this->row_start + total_rows == state.start_row_group->start + state.start_row_group->count);
@@ -419,6 +422,31 @@ void RowGroupCollection::CommitAppend(transaction_t commit_id, idx_t row_start,
 	}
 }
 
+void RowGroupCollection::CleanupVersions(transaction_t lowest_active_start, idx_t row_start, idx_t count) {
+	auto l = row_groups->Lock();
+	idx_t segment_index;
+	if (!row_groups->TryGetSegmentIndex(l, row_start, segment_index)) {
+		// the rows no longer exist (e.g. because the table was truncated)
+		return;
+	}
+	auto row_group = row_groups->GetSegmentByIndex(l, UnsafeNumericCast<int64_t>(segment_index));
+	idx_t current_row = row_start;
+	idx_t remaining = count;
+	while (row_group && remaining > 0) {
+		idx_t start_in_row_group = current_row - row_group->start;
+		if (start_in_row_group >= row_group->count) {
+			break;
+		}
+		idx_t cleanup_count = MinValue<idx_t>(row_group->count - start_in_row_group, remaining);
+
+		row_group->CleanupVersions(lowest_active_start, start_in_row_group, cleanup_count);
+
+		current_row += cleanup_count;
+		remaining -= cleanup_count;
+		row_group = row_groups->GetNextSegment(l, row_group);
+	}
+}
+
 void RowGroupCollection::RevertAppendInternal(idx_t start_row) {
 	total_rows = start_row;
 
@@ -948,7 +976,38 @@ void RowGroupCollection::ScheduleCheckpointTask(CollectionCheckpointState &check
 	checkpoint_state.ScheduleTask(std::move(checkpoint_task));
 }
 
+void RowGroupCollection::SealRowGroups() {
+	auto l = row_groups->Lock();
+	// load all row groups, so the segment count includes the ones that have not been loaded from disk yet
+	row_groups->GetSegmentByIndex(l, -1);
+	sealed_row_groups = row_groups->GetSegmentCount(l);
+}
+
+void RowGroupCollection::CheckpointSealedRowGroups(TableDataWriter &writer, TableStatistics &global_stats) {
+	// the sealed row groups are written in place without vacuuming, as rows are appended to the row groups after them
+	// concurrently (which are written by the next checkpoint)
+	vector<reference<RowGroup>> sealed;
+	{
+		auto l = row_groups->Lock();
+		for (idx_t segment_idx = 0; segment_idx < sealed_row_groups; segment_idx++) {
+			sealed.push_back(*row_groups->GetSegmentByIndex(l, UnsafeNumericCast<int64_t>(segment_idx)));
+		}
+	}
+	for (auto &row_group : sealed) {
+		auto row_group_writer = writer.GetRowGroupWriter(row_group.get());
+		auto write_data = row_group.get().WriteToDisk(*row_group_writer);
+		auto pointer = row_group.get().Checkpoint(std::move(write_data), *row_group_writer, global_stats);
+		writer.AddRowGroup(std::move(pointer), std::move(row_group_writer));
+	}
+	auto l = row_groups->Lock();
+	sealed_row_groups = DConstants::INVALID_INDEX;
+}
+
 void RowGroupCollection::Checkpoint(TableDataWriter &writer, TableStatistics &global_stats) {
+	if (sealed_row_groups != DConstants::INVALID_INDEX) {
+		CheckpointSealedRowGroups(writer, global_stats);
+		return;
+	}
 	auto segments = row_groups->MoveSegments();
 	auto l = row_groups->Lock();
 
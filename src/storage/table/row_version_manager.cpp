@@ -144,15 +144,32 @@ ChunkVectorInfo &RowVersionManager::GetVectorInfo(idx_t vector_idx) {
 		// info exists but it's a constant info: convert to a vector info
 		auto new_info = make_uniq<ChunkVectorInfo>(start + vector_idx * STANDARD_VECTOR_SIZE);
 		new_info->insert_id = constant.insert_id;
-		for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; i++) {
-			new_info->inserted[i] = constant.insert_id;
-		}
 		vector_info[vector_idx] = std::move(new_info);
 	}
 	D_ASSERT(vector_info[vector_idx]->type == ChunkInfoType::VECTOR_INFO);
 	return vector_info[vector_idx]->Cast<ChunkVectorInfo>();
 }
 
+void RowVersionManager::CleanupVersions(transaction_t lowest_active_start, idx_t row_group_start, idx_t count) {
+	if (count == 0) {
+		return;
+	}
+	idx_t row_group_end = row_group_start + count;
+
+	lock_guard<mutex> lock(version_lock);
+	idx_t start_vector_idx = row_group_start / STANDARD_VECTOR_SIZE;
+	idx_t end_vector_idx = (row_group_end - 1) / STANDARD_VECTOR_SIZE;
+	for (idx_t vector_idx = start_vector_idx; vector_idx <= end_vector_idx; vector_idx++) {
+		if (!vector_info[vector_idx]) {
+			continue;
+		}
+		if (vector_info[vector_idx]->Cleanup(lowest_active_start)) {
+			// all rows are visible to every transaction: scans no longer need to check their versions
+			vector_info[vector_idx].reset();
+		}
+	}
+}
+
 idx_t RowVersionManager::DeleteRows(idx_t vector_idx, transaction_t transaction_id, row_t rows[], idx_t count) {
 	lock_guard<mutex> lock(version_lock);
 	has_changes = true;
@@ -1,17 +1,21 @@
 #include "duckdb/storage/temporary_file_manager.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/storage/buffer/temporary_file_information.hpp"
 #include "duckdb/storage/standard_buffer_manager.hpp"
 
+#include "lz4.hpp"
+
 namespace duckdb {
 
 //===--------------------------------------------------------------------===//
 // BlockIndexManager
 //===--------------------------------------------------------------------===//
 
-BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager) : max_index(0), manager(&manager) {
+BlockIndexManager::BlockIndexManager(TemporaryFileManager &manager, idx_t slot_size)
+    : max_index(0), slot_size(slot_size), manager(&manager) {
 }
 
-BlockIndexManager::BlockIndexManager() : max_index(0), manager(nullptr) {
+BlockIndexManager::BlockIndexManager() : max_index(0), slot_size(0), manager(nullptr) {
 }
 
 idx_t BlockIndexManager::GetNewBlockIndex() {
@@ -58,7 +62,6 @@ bool BlockIndexManager::HasFreeBlocks() {
 }
 
 void BlockIndexManager::SetMaxIndex(idx_t new_index) {
-	static constexpr idx_t TEMPFILE_BLOCK_SIZE = Storage::BLOCK_ALLOC_SIZE;
 	if (!manager) {
 		max_index = new_index;
 	} else {
@@ -66,11 +69,11 @@ void BlockIndexManager::SetMaxIndex(idx_t new_index) {
 		if (new_index < old) {
 			max_index = new_index;
 			auto difference = old - new_index;
-			auto size_on_disk = difference * TEMPFILE_BLOCK_SIZE;
+			auto size_on_disk = difference * slot_size;
 			manager->DecreaseSizeOnDisk(size_on_disk);
 		} else if (new_index > old) {
 			auto difference = new_index - old;
-			auto size_on_disk = difference * TEMPFILE_BLOCK_SIZE;
+			auto size_on_disk = difference * slot_size;
 			manager->IncreaseSizeOnDisk(size_on_disk);
 			// Increase can throw, so this is only updated after it was succesfully updated
 			max_index = new_index;
@@ -94,11 +97,20 @@ idx_t BlockIndexManager::GetNewBlockIndexInternal() {
 // TemporaryFileHandle
 //===--------------------------------------------------------------------===//
 
+static string GetTemporaryFileName(idx_t index, idx_t size_class) {
+	if (size_class == TEMPORARY_UNCOMPRESSED_SIZE_CLASS) {
+		return "duckdb_temp_storage-" + to_string(index) + ".tmp";
+	}
+	auto slot_size_kib = (size_class + 1) * TEMPORARY_SLOT_SIZE_UNIT / 1024;
+	return "duckdb_temp_storage_" + to_string(slot_size_kib) + "K-" + to_string(index) + ".tmp";
+}
+
 TemporaryFileHandle::TemporaryFileHandle(idx_t temp_file_count, DatabaseInstance &db, const string &temp_directory,
-                                         idx_t index, TemporaryFileManager &manager)
+                                         idx_t index, idx_t size_class, TemporaryFileManager &manager)
     : max_allowed_index((1 << temp_file_count) * MAX_ALLOWED_INDEX_BASE), db(db), file_index(index),
-      path(FileSystem::GetFileSystem(db).JoinPath(temp_directory, "duckdb_temp_storage-" + to_string(index) + ".tmp")),
-      index_manager(manager) {
+      size_class(size_class), slot_size((size_class + 1) * TEMPORARY_SLOT_SIZE_UNIT),
+      path(FileSystem::GetFileSystem(db).JoinPath(temp_directory, GetTemporaryFileName(index, size_class))),
+      index_manager(manager, slot_size) {
 }
 
 TemporaryFileHandle::TemporaryFileLock::TemporaryFileLock(mutex &mutex) : lock(mutex) {
@@ -114,19 +126,46 @@ TemporaryFileIndex TemporaryFileHandle::TryGetBlockIndex() {
 	CreateFileIfNotExists(lock);
 	// fetch a new block index to write to
 	auto block_index = index_manager.GetNewBlockIndex();
-	return TemporaryFileIndex(file_index, block_index);
+	return TemporaryFileIndex(size_class, file_index, block_index);
 }
 
-void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index) {
+void TemporaryFileHandle::WriteTemporaryFile(FileBuffer &buffer, TemporaryFileIndex index,
+                                             AllocatedData &compressed_buffer) {
 	D_ASSERT(buffer.size == Storage::BLOCK_SIZE);
-	buffer.Write(*handle, GetPositionInFile(index.block_index));
+	D_ASSERT(index.size_class == size_class);
+	if (size_class == TEMPORARY_UNCOMPRESSED_SIZE_CLASS) {
+		buffer.Write(*handle, GetPositionInFile(index.block_index));
+		return;
+	}
+	D_ASSERT(compressed_buffer.GetSize() >= slot_size);
+	handle->Write(compressed_buffer.get(), slot_size, GetPositionInFile(index.block_index));
 }
 
 unique_ptr<FileBuffer> TemporaryFileHandle::ReadTemporaryBuffer(idx_t block_index,
                                                                 unique_ptr<FileBuffer> reusable_buffer) {
-	return StandardBufferManager::ReadTemporaryBufferInternal(BufferManager::GetBufferManager(db), *handle,
-	                                                          GetPositionInFile(block_index), Storage::BLOCK_SIZE,
-	                                                          std::move(reusable_buffer));
+	auto &buffer_manager = BufferManager::GetBufferManager(db);
+	if (size_class == TEMPORARY_UNCOMPRESSED_SIZE_CLASS) {
+		return StandardBufferManager::ReadTemporaryBufferInternal(buffer_manager, *handle,
+		                                                          GetPositionInFile(block_index), Storage::BLOCK_SIZE,
+		                                                          std::move(reusable_buffer));
+	}
+	// read the slot, which holds the compressed size followed by the compressed block
+	auto compressed_buffer = Allocator::Get(db).Allocate(slot_size);
+	handle->Read(compressed_buffer.get(), slot_size, GetPositionInFile(block_index));
+	auto compressed_size = Load<idx_t>(compressed_buffer.get());
+	if (compressed_size > slot_size - sizeof(idx_t)) {
+		throw IOException("Invalid compressed size %llu for block %llu of temporary file \"%s\"", compressed_size,
+		                  block_index, path);
+	}
+
+	auto buffer = buffer_manager.ConstructManagedBuffer(Storage::BLOCK_SIZE, std::move(reusable_buffer));
+	auto decompressed_size = duckdb_lz4::LZ4_decompress_safe(
+	    const_char_ptr_cast(compressed_buffer.get() + sizeof(idx_t)), char_ptr_cast(buffer->buffer),
+	    NumericCast<int>(compressed_size), NumericCast<int>(Storage::BLOCK_SIZE));
+	if (decompressed_size != NumericCast<int>(Storage::BLOCK_SIZE)) {
+		throw IOException("Failed to decompress block %llu of temporary file \"%s\"", block_index, path);
+	}
+	return buffer;
 }
 
 void TemporaryFileHandle::EraseBlockIndex(block_id_t block_index) {
@@ -180,7 +219,7 @@ void TemporaryFileHandle::RemoveTempBlockIndex(TemporaryFileLock &, idx_t index)
 }
 
 idx_t TemporaryFileHandle::GetPositionInFile(idx_t index) {
-	return index * Storage::BLOCK_ALLOC_SIZE;
+	return index * slot_size;
 }
 
 //===--------------------------------------------------------------------===//
@@ -239,8 +278,8 @@ TemporaryFileManager &TemporaryDirectoryHandle::GetTempFile() {
 // TemporaryFileIndex
 //===--------------------------------------------------------------------===//
 
-TemporaryFileIndex::TemporaryFileIndex(idx_t file_index, idx_t block_index)
-    : file_index(file_index), block_index(block_index) {
+TemporaryFileIndex::TemporaryFileIndex(idx_t size_class, idx_t file_index, idx_t block_index)
+    : size_class(size_class), file_index(file_index), block_index(block_index) {
 }
 
 bool TemporaryFileIndex::IsValid() const {
@@ -270,21 +309,54 @@ TemporaryFileManager::TemporaryFileManager(DatabaseInstance &db, const string &t
 }
 
 TemporaryFileManager::~TemporaryFileManager() {
-	files.clear();
+	for (auto &size_class_files : files) {
+		size_class_files.clear();
+	}
 }
 
 TemporaryFileManager::TemporaryManagerLock::TemporaryManagerLock(mutex &mutex) : lock(mutex) {
 }
 
+idx_t TemporaryFileManager::CompressBuffer(FileBuffer &buffer, AllocatedData &compressed_buffer) {
+	auto &config = DBConfig::GetConfig(db);
+	if (config.options.temp_file_compression == TemporaryFileCompression::NONE) {
+		return TEMPORARY_UNCOMPRESSED_SIZE_CLASS;
+	}
+	D_ASSERT(config.options.temp_file_compression == TemporaryFileCompression::LZ4);
+	// blocks that do not compress to a smaller slot size are written uncompressed
+	const idx_t max_slot_size = TEMPORARY_UNCOMPRESSED_SIZE_CLASS * TEMPORARY_SLOT_SIZE_UNIT;
+	compressed_buffer = Allocator::Get(db).Allocate(max_slot_size);
+	auto compressed_size = duckdb_lz4::LZ4_compress_default(
+	    const_char_ptr_cast(buffer.buffer), char_ptr_cast(compressed_buffer.get() + sizeof(idx_t)),
+	    NumericCast<int>(buffer.size), NumericCast<int>(max_slot_size - sizeof(idx_t)));
+	if (compressed_size <= 0) {
+		compressed_buffer.Reset();
+		return TEMPORARY_UNCOMPRESSED_SIZE_CLASS;
+	}
+	// the slot holds the compressed size followed by the compressed block
+	Store<idx_t>(NumericCast<idx_t>(compressed_size), compressed_buffer.get());
+	auto used_size = sizeof(idx_t) + NumericCast<idx_t>(compressed_size);
+	auto size_class = (used_size + TEMPORARY_SLOT_SIZE_UNIT - 1) / TEMPORARY_SLOT_SIZE_UNIT - 1;
+	// zero-initialize the remainder of the slot
+	auto slot_size = (size_class + 1) * TEMPORARY_SLOT_SIZE_UNIT;
+	memset(compressed_buffer.get() + used_size, 0, slot_size - used_size);
+	return size_class;
+}
+
 void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer &buffer) {
 	D_ASSERT(buffer.size == Storage::BLOCK_SIZE);
+	// compress the buffer before grabbing the lock
+	AllocatedData compressed_buffer;
+	auto size_class = CompressBuffer(buffer, compressed_buffer);
+
 	TemporaryFileIndex index;
 	TemporaryFileHandle *handle = nullptr;
 
 	{
 		TemporaryManagerLock lock(manager_lock);
+		auto &size_class_files = files[size_class];
 		// first check if we can write to an open existing file
-		for (auto &entry : files) {
+		for (auto &entry : size_class_files) {
 			auto &temp_file = entry.second;
 			index = temp_file->TryGetBlockIndex();
 			if (index.IsValid()) {
@@ -294,10 +366,11 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 		}
 		if (!handle) {
 			// no existing handle to write to; we need to create & open a new file
-			auto new_file_index = index_manager.GetNewBlockIndex();
-			auto new_file = make_uniq<TemporaryFileHandle>(files.size(), db, temp_directory, new_file_index, *this);
+			auto new_file_index = index_managers[size_class].GetNewBlockIndex();
+			auto new_file = make_uniq<TemporaryFileHandle>(size_class_files.size(), db, temp_directory,
+			                                               new_file_index, size_class, *this);
 			handle = new_file.get();
-			files[new_file_index] = std::move(new_file);
+			size_class_files[new_file_index] = std::move(new_file);
 
 			index = handle->TryGetBlockIndex();
 		}
@@ -306,7 +379,7 @@ void TemporaryFileManager::WriteTemporaryBuffer(block_id_t block_id, FileBuffer
 	}
 	D_ASSERT(handle);
 	D_ASSERT(index.IsValid());
-	handle->WriteTemporaryFile(buffer, index);
+	handle->WriteTemporaryFile(buffer, index, compressed_buffer);
 }
 
 bool TemporaryFileManager::HasTemporaryBuffer(block_id_t block_id) {
@@ -370,7 +443,7 @@ unique_ptr<FileBuffer> TemporaryFileManager::ReadTemporaryBuffer(block_id_t id,
 	{
 		TemporaryManagerLock lock(manager_lock);
 		index = GetTempBlockIndex(lock, id);
-		handle = GetFileHandle(lock, index.file_index);
+		handle = GetFileHandle(lock, index);
 	}
 	auto buffer = handle->ReadTemporaryBuffer(index.block_index, std::move(reusable_buffer));
 	{
@@ -384,15 +457,17 @@ unique_ptr<FileBuffer> TemporaryFileManager::ReadTemporaryBuffer(block_id_t id,
 void TemporaryFileManager::DeleteTemporaryBuffer(block_id_t id) {
 	TemporaryManagerLock lock(manager_lock);
 	auto index = GetTempBlockIndex(lock, id);
-	auto handle = GetFileHandle(lock, index.file_index);
+	auto handle = GetFileHandle(lock, index);
 	EraseUsedBlock(lock, id, handle, index);
 }
 
 vector<TemporaryFileInformation> TemporaryFileManager::GetTemporaryFiles() {
 	lock_guard<mutex> lock(manager_lock);
 	vector<TemporaryFileInformation> result;
-	for (auto &file : files) {
-		result.push_back(file.second->GetTemporaryFile());
+	for (auto &size_class_files : files) {
+		for (auto &file : size_class_files) {
+			result.push_back(file.second->GetTemporaryFile());
+		}
 	}
 	return result;
 }
@@ -406,13 +481,13 @@ void TemporaryFileManager::EraseUsedBlock(TemporaryManagerLock &lock, block_id_t
 	used_blocks.erase(entry);
 	handle->EraseBlockIndex(NumericCast<block_id_t>(index.block_index));
 	if (handle->DeleteIfEmpty()) {
-		EraseFileHandle(lock, index.file_index);
+		EraseFileHandle(lock, index);
 	}
 }
 
 // FIXME: returning a raw pointer???
-TemporaryFileHandle *TemporaryFileManager::GetFileHandle(TemporaryManagerLock &, idx_t index) {
-	return files[index].get();
+TemporaryFileHandle *TemporaryFileManager::GetFileHandle(TemporaryManagerLock &, TemporaryFileIndex index) {
+	return files[index.size_class][index.file_index].get();
 }
 
 TemporaryFileIndex TemporaryFileManager::GetTempBlockIndex(TemporaryManagerLock &, block_id_t id) {
@@ -420,9 +495,9 @@ TemporaryFileIndex TemporaryFileManager::GetTempBlockIndex(TemporaryManagerLock
 	return used_blocks[id];
 }
 
-void TemporaryFileManager::EraseFileHandle(TemporaryManagerLock &, idx_t file_index) {
-	files.erase(file_index);
-	index_manager.RemoveIndex(file_index);
+void TemporaryFileManager::EraseFileHandle(TemporaryManagerLock &, TemporaryFileIndex index) {
+	files[index.size_class].erase(index.file_index);
+	index_managers[index.size_class].RemoveIndex(index.file_index);
 }
 
 } // namespace duckdb
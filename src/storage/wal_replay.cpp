@@ -26,24 +26,240 @@
 #include "duckdb/execution/index/index_type_set.hpp"
 #include "duckdb/execution/index/art/art.hpp"
 #include "duckdb/main/config.hpp"
+#include "duckdb/storage/table/append_state.hpp"
 #include "duckdb/storage/table/delete_state.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
 
+#include "lz4.hpp"
+
+#include <thread>
+
 namespace duckdb {
 
+//! An inserted chunk that has not been appended to its table yet. Compressed chunks are decompressed when they are
+//! appended
+struct PendingInsert {
+	unique_ptr<DataChunk> chunk;
+	unsafe_unique_array<data_t> compressed_chunk;
+	idx_t compressed_size = 0;
+	idx_t uncompressed_size = 0;
+	idx_t row_count = 0;
+};
+
+//! The inserts into a single table that have not been appended yet
+struct PendingTableInserts {
+	explicit PendingTableInserts(TableCatalogEntry &table) : table(table) {
+	}
+
+	TableCatalogEntry &table;
+	vector<PendingInsert> inserts;
+};
+
 class ReplayState {
 public:
-	ReplayState(AttachedDatabase &db, ClientContext &context) : db(db), context(context), catalog(db.GetCatalog()) {
+	ReplayState(AttachedDatabase &db, Connection &con)
+	    : db(db), con(con), context(*con.context), catalog(db.GetCatalog()) {
 	}
 
 	AttachedDatabase &db;
+	Connection &con;
 	ClientContext &context;
 	Catalog &catalog;
 	optional_ptr<TableCatalogEntry> current_table;
 	MetaBlockPointer checkpoint_id;
 	idx_t wal_version = 1;
+
+	//! The inserts of the current transaction that have not been appended yet, per table. Inserts are collected until
+	//! the end of the transaction (or until another kind of entry is replayed), so the tables can be appended to in
+	//! parallel
+	vector<unique_ptr<PendingTableInserts>> pending_inserts;
+	idx_t pending_rows = 0;
+	//! The inserts of committed transactions that have not been appended yet. Consecutive transactions that only
+	//! insert are appended and committed together, so the tables of many small transactions are appended in parallel
+	vector<unique_ptr<PendingTableInserts>> committed_inserts;
+	idx_t committed_rows = 0;
+	//! Whether the replay transaction was modified by the current transaction
+	bool modified = false;
+
+public:
+	void AddInsert(PendingInsert insert);
+	//! Appends the pending inserts of the current transaction to their tables, after committing the inserts of the
+	//! previous transactions, as the replay transaction is modified by the current transaction from here on
+	void FlushInserts();
+	//! Ends the current transaction. Its inserts are appended together with those of the next transactions, unless
+	//! the replay transaction has to be committed now
+	void EndTransaction();
+	//! Appends the inserts of the committed transactions, and commits the replay transaction
+	void CommitTransaction(bool begin_next);
+
+private:
+	idx_t MaxPendingRows() const;
 };
 
+static unique_ptr<DataChunk> DecompressChunk(PendingInsert &insert) {
+	auto buffer = make_unsafe_uniq_array<data_t>(insert.uncompressed_size);
+	auto decompressed_size = duckdb_lz4::LZ4_decompress_safe(
+	    const_char_ptr_cast(insert.compressed_chunk.get()), char_ptr_cast(buffer.get()),
+	    NumericCast<int>(insert.compressed_size), NumericCast<int>(insert.uncompressed_size));
+	if (decompressed_size != NumericCast<int>(insert.uncompressed_size)) {
+		throw SerializationException("Corrupt WAL: failed to decompress inserted chunk");
+	}
+	auto chunk = make_uniq<DataChunk>();
+	MemoryStream stream(buffer.get(), insert.uncompressed_size);
+	BinaryDeserializer deserializer(stream);
+	deserializer.Begin();
+	chunk->Deserialize(deserializer);
+	deserializer.End();
+	return chunk;
+}
+
+void ReplayState::AddInsert(PendingInsert insert) {
+	if (!current_table) {
+		throw InternalException("Corrupt WAL: insert without table");
+	}
+	optional_ptr<PendingTableInserts> table_inserts;
+	for (auto &entry : pending_inserts) {
+		if (&entry->table == current_table.get()) {
+			table_inserts = entry.get();
+			break;
+		}
+	}
+	if (!table_inserts) {
+		pending_inserts.push_back(make_uniq<PendingTableInserts>(*current_table));
+		table_inserts = pending_inserts.back().get();
+	}
+	pending_rows += insert.row_count;
+	table_inserts->inserts.push_back(std::move(insert));
+
+	// bound the memory that is used by the pending inserts
+	if (pending_rows + committed_rows >= MaxPendingRows()) {
+		FlushInserts();
+	}
+}
+
+idx_t ReplayState::MaxPendingRows() const {
+	auto max_threads = NumericCast<idx_t>(DBConfig::GetConfig(context).options.maximum_threads);
+	return MaxValue<idx_t>(max_threads, 1) * Storage::ROW_GROUP_SIZE;
+}
+
+static void AppendInserts(ClientContext &context, PendingTableInserts &table_inserts) {
+	// we don't do any constraint verification here
+	auto &table = table_inserts.table;
+	auto &storage = table.GetStorage();
+	vector<unique_ptr<BoundConstraint>> bound_constraints;
+	LocalAppendState append_state;
+	storage.InitializeLocalAppend(append_state, table, context, bound_constraints);
+	for (auto &insert : table_inserts.inserts) {
+		auto chunk = insert.chunk ? std::move(insert.chunk) : DecompressChunk(insert);
+		insert.compressed_chunk.reset();
+		storage.LocalAppend(append_state, table, context, *chunk);
+	}
+	storage.FinalizeLocalAppend(append_state);
+}
+
+//! Appends the inserts of every table to the table, appending to independent tables in parallel
+static void AppendTables(ClientContext &context, vector<unique_ptr<PendingTableInserts>> tables) {
+	if (tables.empty()) {
+		return;
+	}
+	idx_t thread_count = 1;
+#ifndef DUCKDB_NO_THREADS
+	auto max_threads = NumericCast<idx_t>(DBConfig::GetConfig(context).options.maximum_threads);
+	thread_count = MinValue<idx_t>(tables.size(), MaxValue<idx_t>(max_threads, 1));
+#endif
+	if (thread_count <= 1) {
+		for (auto &table_inserts : tables) {
+			AppendInserts(context, *table_inserts);
+		}
+		return;
+	}
+#ifndef DUCKDB_NO_THREADS
+	// the tables are independent: every thread appends all inserts of the next table that has not been claimed
+	// this runs while the database is loaded, before the threads of the task scheduler are launched
+	atomic<idx_t> next_table(0);
+	mutex error_lock;
+	ErrorData error;
+	auto append_tables = [&]() {
+		while (true) {
+			auto table_idx = next_table++;
+			if (table_idx >= tables.size()) {
+				return;
+			}
+			try {
+				AppendInserts(context, *tables[table_idx]);
+			} catch (std::exception &ex) {
+				lock_guard<mutex> guard(error_lock);
+				if (!error.HasError()) {
+					error = ErrorData(ex);
+				}
+				next_table = tables.size();
+				return;
+			}
+		}
+	};
+	vector<std::thread> threads;
+	for (idx_t i = 1; i < thread_count; i++) {
+		threads.emplace_back(append_tables);
+	}
+	append_tables();
+	for (auto &thread : threads) {
+		thread.join();
+	}
+	if (error.HasError()) {
+		error.Throw();
+	}
+#endif
+}
+
+void ReplayState::FlushInserts() {
+	if (!committed_inserts.empty()) {
+		CommitTransaction(true);
+	}
+	modified = true;
+	auto tables = std::move(pending_inserts);
+	pending_inserts.clear();
+	pending_rows = 0;
+	AppendTables(context, std::move(tables));
+}
+
+void ReplayState::EndTransaction() {
+	for (auto &table_inserts : pending_inserts) {
+		optional_ptr<PendingTableInserts> committed;
+		for (auto &entry : committed_inserts) {
+			if (&entry->table == &table_inserts->table) {
+				committed = entry.get();
+				break;
+			}
+		}
+		if (!committed) {
+			committed_inserts.push_back(std::move(table_inserts));
+			continue;
+		}
+		for (auto &insert : table_inserts->inserts) {
+			committed->inserts.push_back(std::move(insert));
+		}
+	}
+	pending_inserts.clear();
+	committed_rows += pending_rows;
+	pending_rows = 0;
+	if (modified || committed_rows >= MaxPendingRows()) {
+		CommitTransaction(true);
+	}
+}
+
+void ReplayState::CommitTransaction(bool begin_next) {
+	auto tables = std::move(committed_inserts);
+	committed_inserts.clear();
+	committed_rows = 0;
+	AppendTables(context, std::move(tables));
+	con.Commit();
+	modified = false;
+	if (begin_next) {
+		con.BeginTransaction();
+		MetaTransaction::Get(context).ModifyDatabase(db);
+	}
+}
+
 class WriteAheadLogDeserializer {
 public:
 	WriteAheadLogDeserializer(ReplayState &state_p, BufferedFileReader &stream_p, bool deserialize_only = false)
@@ -99,6 +315,10 @@ public:
 		auto wal_type = deserializer.ReadProperty<WALType>(100, "wal_type");
 		if (wal_type == WALType::WAL_FLUSH) {
 			deserializer.End();
+			if (!deserialize_only) {
+				// the transaction is committed
+				state.EndTransaction();
+			}
 			return true;
 		}
 		ReplayEntry(wal_type);
@@ -143,6 +363,7 @@ protected:
 
 	void ReplayUseTable();
 	void ReplayInsert();
+	void ReplayCompressedInsert();
 	void ReplayDelete();
 	void ReplayUpdate();
 	void ReplayCheckpoint();
@@ -176,7 +397,7 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 	auto &config = DBConfig::GetConfig(database.GetDatabase());
 	// first deserialize the WAL to look for a checkpoint flag
 	// if there is a checkpoint flag, we might have already flushed the contents of the WAL to disk
-	ReplayState checkpoint_state(database, *con.context);
+	ReplayState checkpoint_state(database, con);
 	try {
 		while (true) {
 			// read the current entry (deserialize only)
@@ -207,7 +428,7 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 	}
 
 	// we need to recover from the WAL: actually set up the replay state
-	ReplayState state(database, *con.context);
+	ReplayState state(database, con);
 
 	// reset the reader - we are going to read the WAL from the beginning again
 	reader.Reset();
@@ -220,14 +441,12 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 			// read the current entry
 			auto deserializer = WriteAheadLogDeserializer::Open(state, reader);
 			if (deserializer.ReplayEntry()) {
-				con.Commit();
 				// check if the file is exhausted
 				if (reader.Finished()) {
-					// we finished reading the file: break
+					// we finished reading the file: commit the remaining transactions and break
+					state.CommitTransaction(false);
 					break;
 				}
-				con.BeginTransaction();
-				MetaTransaction::Get(*con.context).ModifyDatabase(database);
 			}
 		}
 	} catch (std::exception &ex) { // LCOV_EXCL_START
@@ -240,6 +459,12 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 		if (config.options.abort_on_wal_failure || error.Type() != ExceptionType::SERIALIZATION) {
 			error.Throw("Failure while replaying WAL file \"" + wal_path + "\": ");
 		}
+		// the inserts of the committed transactions before the truncated one have not been appended yet
+		if (!state.committed_inserts.empty()) {
+			con.BeginTransaction();
+			MetaTransaction::Get(*con.context).ModifyDatabase(database);
+			state.CommitTransaction(false);
+		}
 	} catch (...) {
 		// exception thrown in WAL replay: rollback
 		con.Query("ROLLBACK");
@@ -252,6 +477,11 @@ bool WriteAheadLog::Replay(AttachedDatabase &database, unique_ptr<FileHandle> ha
 // Replay Entries
 //===--------------------------------------------------------------------===//
 void WriteAheadLogDeserializer::ReplayEntry(WALType entry_type) {
+	if (!deserialize_only && entry_type != WALType::USE_TABLE && entry_type != WALType::INSERT_TUPLE &&
+	    entry_type != WALType::COMPRESSED_INSERT_TUPLE) {
+		// other entries are replayed in order with the inserts
+		state.FlushInserts();
+	}
 	switch (entry_type) {
 	case WALType::WAL_VERSION:
 		ReplayVersion();
@@ -310,6 +540,9 @@ void WriteAheadLogDeserializer::ReplayEntry(WALType entry_type) {
 	case WALType::INSERT_TUPLE:
 		ReplayInsert();
 		break;
+	case WALType::COMPRESSED_INSERT_TUPLE:
+		ReplayCompressedInsert();
+		break;
 	case WALType::DELETE_TUPLE:
 		ReplayDelete();
 		break;
@@ -651,19 +884,30 @@ void WriteAheadLogDeserializer::ReplayUseTable() {
 }
 
 void WriteAheadLogDeserializer::ReplayInsert() {
-	DataChunk chunk;
-	deserializer.ReadObject(101, "chunk", [&](Deserializer &object) { chunk.Deserialize(object); });
+	PendingInsert insert;
+	insert.chunk = make_uniq<DataChunk>();
+	deserializer.ReadObject(101, "chunk", [&](Deserializer &object) { insert.chunk->Deserialize(object); });
 	if (DeserializeOnly()) {
 		return;
 	}
-	if (!state.current_table) {
-		throw InternalException("Corrupt WAL: insert without table");
-	}
+	// the chunk is appended to the current table in FlushInserts
+	insert.row_count = insert.chunk->size();
+	state.AddInsert(std::move(insert));
+}
 
-	// append to the current table
-	// we don't do any constraint verification here
-	vector<unique_ptr<BoundConstraint>> bound_constraints;
-	state.current_table->GetStorage().LocalAppend(*state.current_table, context, chunk, bound_constraints);
+void WriteAheadLogDeserializer::ReplayCompressedInsert() {
+	PendingInsert insert;
+	insert.uncompressed_size = deserializer.ReadProperty<idx_t>(101, "uncompressed_size");
+	insert.compressed_size = deserializer.ReadProperty<idx_t>(102, "compressed_size");
+	insert.compressed_chunk = make_unsafe_uniq_array<data_t>(insert.compressed_size);
+	deserializer.ReadProperty(103, "compressed_chunk", insert.compressed_chunk.get(), insert.compressed_size);
+	if (DeserializeOnly()) {
+		return;
+	}
+	// the chunk is decompressed and appended to the current table in FlushInserts
+	// the row count is only used to bound the pending inserts, a chunk has at most STANDARD_VECTOR_SIZE rows
+	insert.row_count = STANDARD_VECTOR_SIZE;
+	state.AddInsert(std::move(insert));
 }
 
 void WriteAheadLogDeserializer::ReplayDelete() {
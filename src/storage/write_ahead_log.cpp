@@ -15,13 +15,22 @@
 #include "duckdb/storage/table_io_manager.hpp"
 #include "duckdb/common/checksum.hpp"
 #include "duckdb/common/serializer/memory_stream.hpp"
+#include "duckdb/main/config.hpp"
+
+#include "lz4.hpp"
+
+#include <chrono>
+#include <thread>
 
 namespace duckdb {
 
 const uint64_t WAL_VERSION_NUMBER = 2;
+//! Inserted chunks that serialize to at least this many bytes are compressed
+const idx_t WAL_COMPRESSION_THRESHOLD = 16384;
 
 WriteAheadLog::WriteAheadLog(AttachedDatabase &database, const string &wal_path)
-    : skip_writing(false), database(database), wal_path(wal_path) {
+    : skip_writing(false), database(database), wal_path(wal_path), sync_in_progress(false),
+      requested_sync_position(0), synced_position(0) {
 }
 
 WriteAheadLog::~WriteAheadLog() {
@@ -135,6 +144,14 @@ public:
 		serializer.WriteProperty(field_id, tag, value);
 	}
 
+	void WriteProperty(const field_id_t field_id, const char *tag, const_data_ptr_t ptr, idx_t count) {
+		if (wal.skip_writing) {
+			return;
+		}
+		D_ASSERT(wal.Initialized());
+		serializer.WriteProperty(field_id, tag, ptr, count);
+	}
+
 	template <class FUNC>
 	void WriteList(const field_id_t field_id, const char *tag, idx_t count, FUNC func) {
 		if (wal.skip_writing) {
@@ -361,6 +378,33 @@ void WriteAheadLog::WriteInsert(DataChunk &chunk) {
 	D_ASSERT(chunk.size() > 0);
 	chunk.Verify();
 
+	if (!skip_writing) {
+		// large chunks are compressed with LZ4
+		MemoryStream chunk_stream;
+		BinarySerializer chunk_serializer(chunk_stream);
+		chunk_serializer.Begin();
+		chunk.Serialize(chunk_serializer);
+		chunk_serializer.End();
+		auto chunk_size = chunk_stream.GetPosition();
+		if (chunk_size >= WAL_COMPRESSION_THRESHOLD) {
+			auto bound = NumericCast<idx_t>(duckdb_lz4::LZ4_compressBound(NumericCast<int>(chunk_size)));
+			auto compressed_buffer = make_unsafe_uniq_array<data_t>(bound);
+			auto compressed_size = duckdb_lz4::LZ4_compress_default(
+			    const_char_ptr_cast(chunk_stream.GetData()), char_ptr_cast(compressed_buffer.get()),
+			    NumericCast<int>(chunk_size), NumericCast<int>(bound));
+			// only write the compressed chunk if it saves at least 10% of the size
+			if (compressed_size > 0 && NumericCast<idx_t>(compressed_size) < chunk_size - chunk_size / 10) {
+				WriteAheadLogSerializer serializer(*this, WALType::COMPRESSED_INSERT_TUPLE);
+				serializer.WriteProperty(101, "uncompressed_size", chunk_size);
+				serializer.WriteProperty(102, "compressed_size", NumericCast<idx_t>(compressed_size));
+				serializer.WriteProperty(103, "compressed_chunk", compressed_buffer.get(),
+				                         NumericCast<idx_t>(compressed_size));
+				serializer.End();
+				return;
+			}
+		}
+	}
+
 	WriteAheadLogSerializer serializer(*this, WALType::INSERT_TUPLE);
 	serializer.WriteProperty(101, "chunk", chunk);
 	serializer.End();
@@ -412,6 +456,60 @@ void WriteAheadLog::Flush() {
 
 	// flushes all changes made to the WAL to disk
 	writer->Sync();
+
+	lock_guard<mutex> guard(sync_lock);
+	synced_position = MaxValue<idx_t>(synced_position, writer->GetTotalWritten());
+}
+
+idx_t WriteAheadLog::FlushCommit() {
+	if (skip_writing) {
+		return 0;
+	}
+	D_ASSERT(writer);
+
+	// write an empty entry
+	WriteAheadLogSerializer serializer(*this, WALType::WAL_FLUSH);
+	serializer.End();
+
+	// write the changes to the file - they are synced by SyncCommit
+	writer->Flush();
+	return writer->GetTotalWritten();
+}
+
+void WriteAheadLog::SyncCommit(idx_t position) {
+	unique_lock<mutex> guard(sync_lock);
+	requested_sync_position = MaxValue<idx_t>(requested_sync_position, position);
+	while (synced_position < position) {
+		if (sync_in_progress) {
+			// another commit is syncing the WAL - wait for it, its sync might include our position
+			sync_cv.wait(guard);
+			continue;
+		}
+		// we sync the WAL for all commits that have requested a sync so far
+		sync_in_progress = true;
+		guard.unlock();
+		auto commit_delay = DBConfig::GetConfig(database.GetDatabase()).options.commit_delay;
+		if (commit_delay > 0) {
+			// wait for concurrent commits to request a sync as well
+			std::this_thread::sleep_for(std::chrono::microseconds(commit_delay));
+		}
+		guard.lock();
+		auto sync_position = requested_sync_position;
+		guard.unlock();
+		// the file handle is only synced - the buffer of the writer can be written to concurrently
+		try {
+			writer->handle->Sync();
+		} catch (...) {
+			guard.lock();
+			sync_in_progress = false;
+			sync_cv.notify_all();
+			throw;
+		}
+		guard.lock();
+		synced_position = MaxValue<idx_t>(synced_position, sync_position);
+		sync_in_progress = false;
+		sync_cv.notify_all();
+	}
 }
 
 } // namespace duckdb
@@ -1,4 +1,5 @@
 #include "duckdb/transaction/cleanup_state.hpp"
+#include "duckdb/transaction/append_info.hpp"
 #include "duckdb/transaction/delete_info.hpp"
 #include "duckdb/transaction/update_info.hpp"
 
@@ -12,7 +13,8 @@
 
 namespace duckdb {
 
-CleanupState::CleanupState() : current_table(nullptr), count(0) {
+CleanupState::CleanupState(transaction_t lowest_active_transaction, transaction_t commit_id)
+    : lowest_active_transaction(lowest_active_transaction), commit_id(commit_id), current_table(nullptr), count(0) {
 }
 
 CleanupState::~CleanupState() {
@@ -29,6 +31,11 @@ void CleanupState::CleanupEntry(UndoFlags type, data_ptr_t data) {
 		entry.set->CleanupEntry(entry);
 		break;
 	}
+	case UndoFlags::INSERT_TUPLE: {
+		auto info = reinterpret_cast<AppendInfo *>(data);
+		CleanupAppend(*info);
+		break;
+	}
 	case UndoFlags::DELETE_TUPLE: {
 		auto info = reinterpret_cast<DeleteInfo *>(data);
 		CleanupDelete(*info);
@@ -50,8 +57,15 @@ void CleanupState::CleanupUpdate(UpdateInfo &info) {
 	info.segment->CleanupUpdate(info);
 }
 
+void CleanupState::CleanupAppend(AppendInfo &info) {
+	// drop the version info of the appended rows if they are visible to every running transaction
+	info.table->CleanupVersions(lowest_active_transaction, info.start_row, info.count);
+}
+
 void CleanupState::CleanupDelete(DeleteInfo &info) {
 	auto version_table = info.table;
+	// compact the version info of the vector if the delete is visible to every running transaction
+	version_table->CleanupVersions(lowest_active_transaction, info.base_row, STANDARD_VECTOR_SIZE);
 	if (!version_table->HasIndexes()) {
 		// this table has no indexes: no cleanup to be done
 		return;
@@ -89,6 +103,8 @@ void CleanupState::Flush() {
 	Vector row_identifiers(LogicalType::ROW_TYPE, data_ptr_cast(row_numbers));
 
 	// delete the tuples from all the indexes
+	// transactions that started before the commit can still see the tuples, but no longer find them in the indexes
+	current_table->GetDataTableInfo()->SetIndexCleanupCommit(commit_id);
 	try {
 		current_table->RemoveFromIndexes(row_identifiers, count);
 	} catch (...) { // NOLINT: ignore errors here
@@ -193,6 +193,13 @@ ErrorData DuckTransaction::Commit(AttachedDatabase &db, transaction_t new_commit
 		undo_buffer.Commit(iterator_state, log, commit_id);
 		if (storage_commit_state) {
 			storage_commit_state->FlushCommit();
+			if (write_lock) {
+				// the checkpoint lock prevents the WAL from being checkpointed until this transaction is finished
+				// the sync of the WAL can be done after the transaction lock has been released (see SyncCommit)
+				this->storage_commit_state = std::move(storage_commit_state);
+			} else {
+				storage_commit_state->SyncCommit();
+			}
 		}
 		return ErrorData();
 	} catch (std::exception &ex) {
@@ -201,21 +208,48 @@ ErrorData DuckTransaction::Commit(AttachedDatabase &db, transaction_t new_commit
 	}
 }
 
+ErrorData DuckTransaction::SyncCommit() noexcept {
+	if (!storage_commit_state) {
+		return ErrorData();
+	}
+	try {
+		storage_commit_state->SyncCommit();
+		storage_commit_state.reset();
+		return ErrorData();
+	} catch (std::exception &ex) {
+		storage_commit_state.reset();
+		return ErrorData(ex);
+	}
+}
+
 void DuckTransaction::Rollback() noexcept {
 	storage->Rollback();
 	undo_buffer.Rollback();
 }
 
-void DuckTransaction::Cleanup() {
-	undo_buffer.Cleanup();
+void DuckTransaction::Cleanup(transaction_t lowest_active_transaction) {
+	undo_buffer.Cleanup(lowest_active_transaction, commit_id);
 }
 
 void DuckTransaction::SetReadWrite() {
 	Transaction::SetReadWrite();
+	if (transaction_manager.BackgroundCheckpointRunning()) {
+		// appends do not conflict with a background checkpoint: we only obtain the checkpoint lock if this
+		// transaction modifies the existing data (see ModifyExistingData), or when it commits
+		return;
+	}
 	// obtain a shared checkpoint lock to prevent concurrent checkpoints while this transaction is running
 	write_lock = transaction_manager.SharedCheckpointLock();
 }
 
+void DuckTransaction::ModifyExistingData() {
+	if (write_lock) {
+		return;
+	}
+	// this blocks until a running background checkpoint has finished
+	write_lock = transaction_manager.SharedCheckpointLock();
+}
+
 unique_ptr<StorageLockKey> DuckTransaction::TryGetCheckpointLock() {
 	if (!write_lock) {
 		throw InternalException("TryUpgradeCheckpointLock - but thread has no shared lock!?");
@@ -13,11 +13,14 @@
 #include "duckdb/main/connection_manager.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/valid_checker.hpp"
+#include "duckdb/transaction/local_storage.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
 
 namespace duckdb {
 
-DuckTransactionManager::DuckTransactionManager(AttachedDatabase &db) : TransactionManager(db) {
+DuckTransactionManager::DuckTransactionManager(AttachedDatabase &db)
+    : TransactionManager(db), background_checkpoint_running(false) {
 	// start timestamp starts at two
 	current_start_timestamp = 2;
 	// transaction ID starts very high:
@@ -30,6 +33,7 @@ DuckTransactionManager::DuckTransactionManager(AttachedDatabase &db) : Transacti
 }
 
 DuckTransactionManager::~DuckTransactionManager() {
+	WaitForBackgroundCheckpoint();
 }
 
 DuckTransactionManager &DuckTransactionManager::Get(AttachedDatabase &db) {
@@ -92,6 +96,9 @@ DuckTransactionManager::CanCheckpoint(DuckTransaction &transaction, unique_ptr<S
 	if (!transaction.AutomaticCheckpoint(db, undo_properties)) {
 		return CheckpointDecision("no reason to automatically checkpoint");
 	}
+	if (!transaction.HasCheckpointLock()) {
+		return CheckpointDecision("a background checkpoint is running");
+	}
 	// try to lock the checkpoint lock
 	lock = transaction.TryGetCheckpointLock();
 	if (!lock) {
@@ -141,6 +148,9 @@ void DuckTransactionManager::Checkpoint(ClientContext &context, bool force) {
 		return;
 	}
 
+	// a background checkpoint holds the checkpoint lock until it has finished
+	WaitForBackgroundCheckpoint();
+
 	auto current = Transaction::TryGet(context, db);
 	if (current) {
 		if (force) {
@@ -194,6 +204,74 @@ unique_ptr<StorageLockKey> DuckTransactionManager::TryUpgradeCheckpointLock(Stor
 	return checkpoint_lock.TryUpgradeCheckpointLock(lock);
 }
 
+bool DuckTransactionManager::CanCommitDuringCheckpoint(DuckTransaction &transaction) {
+	if (!background_checkpoint_running) {
+		return false;
+	}
+	// the transaction has only appended rows (see DuckTransaction::ModifyExistingData)
+	// these go into new row groups that the checkpoint does not write, but indexes are written by the checkpoint
+	auto properties = transaction.GetUndoProperties();
+	if (properties.has_updates || properties.has_deletes || properties.has_catalog_changes) {
+		return false;
+	}
+	return !transaction.GetLocalStorage().AppendsToIndexedTables();
+}
+
+void DuckTransactionManager::StartBackgroundCheckpoint(unique_ptr<StorageLockKey> checkpoint_lock) {
+	if (background_checkpoint_thread) {
+		// the previous background checkpoint has released the checkpoint lock, so its thread is finished
+		background_checkpoint_thread->join();
+		background_checkpoint_thread.reset();
+	}
+	// seal the tables and switch the WAL while holding the transaction lock, so no commit is split over both
+	db.GetStorageManager().BeginBackgroundCheckpoint();
+	background_checkpoint_lock = std::move(checkpoint_lock);
+	background_checkpoint_running = true;
+	background_checkpoint_thread = make_uniq<thread>([this]() { RunBackgroundCheckpoint(); });
+}
+
+void DuckTransactionManager::RunBackgroundCheckpoint() {
+	unique_ptr<StorageLockKey> checkpoint_lock;
+	{
+		lock_guard<mutex> lock(transaction_lock);
+		checkpoint_lock = std::move(background_checkpoint_lock);
+	}
+	auto &storage_manager = db.GetStorageManager();
+	bool success = true;
+	try {
+		// the checkpoint does not vacuum: other transactions refer to rows by their row ids while it runs
+		CheckpointOptions options;
+		options.action = CheckpointAction::FORCE_CHECKPOINT;
+		options.type = CheckpointType::CONCURRENT_CHECKPOINT;
+		storage_manager.CreateCheckpoint(options);
+	} catch (std::exception &ex) {
+		// there is no query that the error can be reported to: invalidate the database instead
+		ErrorData error(ex);
+		ValidChecker::Invalidate(db.GetDatabase(), error.RawMessage());
+		success = false;
+	}
+	{
+		lock_guard<mutex> lock(transaction_lock);
+		if (success) {
+			storage_manager.FinishBackgroundCheckpoint();
+		}
+		background_checkpoint_running = false;
+	}
+	// release the checkpoint lock: transactions that wait for the checkpoint can continue
+	checkpoint_lock.reset();
+}
+
+void DuckTransactionManager::WaitForBackgroundCheckpoint() {
+	unique_ptr<thread> checkpoint_thread;
+	{
+		lock_guard<mutex> lock(transaction_lock);
+		checkpoint_thread = std::move(background_checkpoint_thread);
+	}
+	if (checkpoint_thread) {
+		checkpoint_thread->join();
+	}
+}
+
 transaction_t DuckTransactionManager::GetCommitTimestamp() {
 	auto commit_ts = current_start_timestamp++;
 	last_commit = commit_ts;
@@ -203,6 +281,13 @@ transaction_t DuckTransactionManager::GetCommitTimestamp() {
 ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Transaction &transaction_p) {
 	auto &transaction = transaction_p.Cast<DuckTransaction>();
 	unique_lock<mutex> tlock(transaction_lock);
+	// a transaction that started writing while a background checkpoint was running has not obtained the checkpoint
+	// lock: unless it can be committed while the checkpoint is running, it waits for the checkpoint to finish
+	while (!transaction.IsReadOnly() && !transaction.HasCheckpointLock() && !CanCommitDuringCheckpoint(transaction)) {
+		tlock.unlock();
+		transaction.ModifyExistingData();
+		tlock.lock();
+	}
 	if (!db.IsSystem() && !db.IsTemporary()) {
 		if (transaction.ChangesMade()) {
 			if (transaction.IsReadOnly()) {
@@ -218,13 +303,36 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 	unique_ptr<StorageLockKey> lock;
 	auto undo_properties = transaction.GetUndoProperties();
 	auto checkpoint_decision = CanCheckpoint(transaction, lock, undo_properties);
+	bool background_checkpoint = false;
+#ifndef DUCKDB_NO_THREADS
+	background_checkpoint =
+	    checkpoint_decision.can_checkpoint && DBConfig::GetConfig(db.GetDatabase()).options.background_checkpoint;
+#endif
 	// commit the UndoBuffer of the transaction
-	auto error = transaction.Commit(db, commit_id, checkpoint_decision.can_checkpoint);
+	// if we checkpoint in the background, the commit is written to the WAL, as the checkpoint can still fail
+	auto error = transaction.Commit(db, commit_id, checkpoint_decision.can_checkpoint && !background_checkpoint);
 	if (error.HasError()) {
 		// commit unsuccessful: rollback the transaction instead
 		checkpoint_decision = CheckpointDecision(error.Message());
 		transaction.commit_id = 0;
 		transaction.Rollback();
+	} else {
+		// make the commit durable - unless we checkpoint, the transaction lock is released while syncing the WAL, so
+		// concurrent commits can be made durable by the same sync (group commit)
+		// the checkpoint lock of the transaction prevents the WAL from being checkpointed in the meantime
+		if (!checkpoint_decision.can_checkpoint) {
+			tlock.unlock();
+		}
+		auto sync_error = transaction.SyncCommit();
+		if (!tlock.owns_lock()) {
+			tlock.lock();
+		}
+		if (sync_error.HasError()) {
+			// the transaction is already visible to other transactions, but it could not be made durable
+			ValidChecker::Invalidate(db.GetDatabase(), sync_error.RawMessage());
+			checkpoint_decision = CheckpointDecision(sync_error.Message());
+			error = std::move(sync_error);
+		}
 	}
 	OnCommitCheckpointDecision(checkpoint_decision, transaction);
 
@@ -239,7 +347,10 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 	RemoveTransaction(transaction, store_transaction);
 	// now perform a checkpoint if (1) we are able to checkpoint, and (2) the WAL has reached sufficient size to
 	// checkpoint
-	if (checkpoint_decision.can_checkpoint) {
+	if (checkpoint_decision.can_checkpoint && background_checkpoint) {
+		D_ASSERT(lock);
+		StartBackgroundCheckpoint(std::move(lock));
+	} else if (checkpoint_decision.can_checkpoint) {
 		D_ASSERT(lock);
 		// we can unlock the transaction lock while checkpointing
 		tlock.unlock();
@@ -307,7 +418,7 @@ void DuckTransactionManager::RemoveTransaction(DuckTransaction &transaction, boo
 			old_transactions.push_back(std::move(current_transaction));
 		}
 	} else if (transaction.ChangesMade()) {
-		transaction.Cleanup();
+		transaction.Cleanup(lowest_start_time);
 	}
 	// remove the transaction from the set of currently active transactions
 	active_transactions.unsafe_erase_at(t_index);
@@ -329,7 +440,7 @@ void DuckTransactionManager::RemoveTransaction(DuckTransaction &transaction, boo
 			// we can only safely do the actual memory cleanup when all the
 			// currently active queries have finished running! (actually,
 			// when all the currently active scans have finished running...)
-			recently_committed_transactions[i]->Cleanup();
+			recently_committed_transactions[i]->Cleanup(lowest_start_time);
 			// store the current highest active query
 			recently_committed_transactions[i]->highest_active_query = current_query;
 			// move it to the list of transactions awaiting GC
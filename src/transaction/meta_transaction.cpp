@@ -142,7 +142,7 @@ void MetaTransaction::SetActiveQuery(transaction_t query_number) {
 	}
 }
 
-void MetaTransaction::ModifyDatabase(AttachedDatabase &db) {
+void MetaTransaction::ModifyDatabase(AttachedDatabase &db, bool only_appends) {
 	if (db.IsSystem() || db.IsTemporary()) {
 		// we can always modify the system and temp databases
 		return;
@@ -152,14 +152,15 @@ void MetaTransaction::ModifyDatabase(AttachedDatabase &db) {
 
 		auto &transaction = GetTransaction(db);
 		transaction.SetReadWrite();
-		return;
-	}
-	if (&db != modified_database.get()) {
+	} else if (&db != modified_database.get()) {
 		throw TransactionException(
 		    "Attempting to write to database \"%s\" in a transaction that has already modified database \"%s\" - a "
 		    "single transaction can only write to a single attached database.",
 		    db.GetName(), modified_database->GetName());
 	}
+	if (!only_appends) {
+		GetTransaction(db).ModifyExistingData();
+	}
 }
 
 } // namespace duckdb
@@ -151,7 +151,7 @@ UndoBufferProperties UndoBuffer::GetProperties() {
 	return properties;
 }
 
-void UndoBuffer::Cleanup() {
+void UndoBuffer::Cleanup(transaction_t lowest_active_transaction, transaction_t commit_id) {
 	// garbage collect everything in the Undo Chunk
 	// this should only happen if
 	//  (1) the transaction this UndoBuffer belongs to has successfully
@@ -160,14 +160,28 @@ void UndoBuffer::Cleanup() {
 	//      the chunks)
 	//  (2) there is no active transaction with start_id < commit_id of this
 	//  transaction
-	CleanupState state;
-	UndoBuffer::IteratorState iterator_state;
-	IterateEntries(iterator_state, [&](UndoFlags type, data_ptr_t data) { state.CleanupEntry(type, data); });
+	{
+		CleanupState state(lowest_active_transaction, commit_id);
+		UndoBuffer::IteratorState iterator_state;
+		IterateEntries(iterator_state, [&](UndoFlags type, data_ptr_t data) {
+			if (type != UndoFlags::CATALOG_ENTRY) {
+				state.CleanupEntry(type, data);
+			}
+		});
 
-	// possibly vacuum indexes
-	for (auto &table : state.indexed_tables) {
-		table.second->VacuumIndexes();
+		// possibly vacuum indexes
+		for (auto &table : state.indexed_tables) {
+			table.second->VacuumIndexes();
+		}
 	}
+	// clean up the catalog entries last: the tuple entries can refer to tables that were dropped by this transaction
+	CleanupState state(lowest_active_transaction, commit_id);
+	UndoBuffer::IteratorState iterator_state;
+	IterateEntries(iterator_state, [&](UndoFlags type, data_ptr_t data) {
+		if (type == UndoFlags::CATALOG_ENTRY) {
+			state.CleanupEntry(type, data);
+		}
+	});
 }
 
 void UndoBuffer::Commit(UndoBuffer::IteratorState &iterator_state, optional_ptr<WriteAheadLog> log,
@@ -47,6 +47,9 @@ OptionValueSet &GetValueForOption(const string &name) {
 	static unordered_map<string, OptionValueSet> value_map = {
 	    {"threads", {Value::BIGINT(42), Value::BIGINT(42)}},
 	    {"checkpoint_threshold", {"4.0 GiB"}},
+	    {"background_checkpoint", {Value(true)}},
+	    {"bulk_update_threshold", {Value::UBIGINT(42)}},
+	    {"commit_delay", {Value::UBIGINT(100)}},
 	    {"debug_checkpoint_abort", {{"none", "before_truncate", "before_header", "after_free_list_write"}}},
 	    {"default_collation", {"nocase"}},
 	    {"default_order", {"desc"}},
@@ -83,21 +86,26 @@ OptionValueSet &GetValueForOption(const string &name) {
 	    {"explain_output", {{"all", "optimized_only", "physical_only"}}},
 	    {"file_search_path", {"test"}},
 	    {"force_compression", {"uncompressed", "Uncompressed"}},
+	    {"force_index_join", {true}},
 	    {"home_directory", {"test"}},
 	    {"allow_extensions_metadata_mismatch", {"true"}},
 	    {"integer_division", {true}},
 	    {"extension_directory", {"test"}},
 	    {"immediate_transaction_mode", {true}},
+	    {"late_materialization_max_rows", {Value::UBIGINT(42)}},
 	    {"max_expression_depth", {50}},
 	    {"max_memory", {"4.0 GiB"}},
+	    {"max_query_threads", {2}},
 	    {"max_temp_directory_size", {"10.0 GiB"}},
 	    {"memory_limit", {"4.0 GiB"}},
 	    {"storage_compatibility_version", {"v0.10.0"}},
 	    {"ordered_aggregate_threshold", {Value::UBIGINT(idx_t(1) << 12)}},
 	    {"null_order", {"nulls_first"}},
+	    {"numa_bind_queries", {true}},
 	    {"perfect_ht_threshold", {0}},
 	    {"pivot_filter_threshold", {999}},
 	    {"pivot_limit", {999}},
+	    {"pin_threads", {"off"}},
 	    {"partitioned_write_flush_threshold", {123}},
 	    {"preserve_identifier_case", {false}},
 	    {"preserve_insertion_order", {false}},
@@ -105,7 +113,9 @@ OptionValueSet &GetValueForOption(const string &name) {
 	    {"profiling_mode", {"detailed"}},
 	    {"enable_progress_bar_print", {false}},
 	    {"progress_bar_time", {0}},
+	    {"query_priority", {"high"}},
 	    {"temp_directory", {"tmp"}},
+	    {"temp_file_compression", {"lz4"}},
 	    {"wal_autocheckpoint", {"4.0 GiB"}},
 	    {"worker_threads", {42}},
 	    {"enable_http_metadata_cache", {true}},
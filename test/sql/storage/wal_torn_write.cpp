@@ -116,3 +116,53 @@ TEST_CASE("Test WAL checksums", "[storage][.]") {
 	}
 	DeleteDatabase(storage_database);
 }
+
+TEST_CASE("Test torn WAL writes after transactions that only insert", "[storage][.]") {
+	auto config = GetTestConfig();
+	duckdb::unique_ptr<QueryResult> result;
+	auto storage_database = TestCreatePath("storage_test");
+	auto storage_wal = storage_database + ".wal";
+
+	LocalFileSystem lfs;
+	config->options.checkpoint_wal_size = idx_t(-1);
+	config->options.checkpoint_on_shutdown = false;
+	config->options.abort_on_wal_failure = false;
+	idx_t wal_size_two_inserts;
+	idx_t wal_size_three_inserts;
+	// the inserts of consecutive transactions are appended together during the replay
+	// obtain the size of the WAL after two and after three of these transactions
+	DeleteDatabase(storage_database);
+	{
+		DuckDB db(storage_database, config.get());
+		Connection con(db);
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE A (a INTEGER);"));
+		REQUIRE_NO_FAIL(con.Query("INSERT INTO A VALUES (1);"));
+		REQUIRE_NO_FAIL(con.Query("INSERT INTO A VALUES (2);"));
+		wal_size_two_inserts = GetWALFileSize(lfs, storage_wal);
+		REQUIRE_NO_FAIL(con.Query("INSERT INTO A VALUES (3);"));
+		wal_size_three_inserts = GetWALFileSize(lfs, storage_wal);
+	}
+	DeleteDatabase(storage_database);
+
+	// the third transaction is torn: the inserts of the first two transactions must still be replayed
+	for (idx_t i = wal_size_two_inserts + 1; i < wal_size_three_inserts; i++) {
+		DeleteDatabase(storage_database);
+		{
+			DuckDB db(storage_database, config.get());
+			Connection con(db);
+			REQUIRE_NO_FAIL(con.Query("CREATE TABLE A (a INTEGER);"));
+			REQUIRE_NO_FAIL(con.Query("INSERT INTO A VALUES (1);"));
+			REQUIRE_NO_FAIL(con.Query("INSERT INTO A VALUES (2);"));
+			REQUIRE_NO_FAIL(con.Query("INSERT INTO A VALUES (3);"));
+		}
+		TruncateWAL(lfs, storage_wal, i);
+		{
+			DuckDB db(storage_database, config.get());
+			Connection con(db);
+			result = con.Query("SELECT COUNT(*), SUM(a) FROM A");
+			REQUIRE(CHECK_COLUMN(result, 0, {2}));
+			REQUIRE(CHECK_COLUMN(result, 1, {3}));
+		}
+	}
+	DeleteDatabase(storage_database);
+}
@@ -32,6 +32,8 @@
     - LZ4 homepage : http://www.lz4.org
     - LZ4 source repository : https://github.com/lz4/lz4
 */
+#pragma once
+
 //#if defined (__cplusplus)
 //extern "C" {
 //#endif